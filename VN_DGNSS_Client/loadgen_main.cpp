@@ -0,0 +1,327 @@
+// Headless load generator: simulates many rovers against a VN-DGNSS server.
+// Every rover connects, sends $POSECEF with a random position and system
+// selection, and checks the RTCM stream it receives. The epoch latency
+// (arrival - epoch time of the MSM) and jitter (arrival interval - epoch
+// interval) are kept per rover.
+#include <netdb.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+
+#include <random>
+
+#include "connection.h"
+#include "epoch_histogram.h"
+#include "rtcm_checker.h"
+
+#define GPS_LEAP_SEC      18
+#define GPST0_UNIX        315964800  // 1980-01-06 in unix time
+#define SEC_OF_WEEK       604800
+#define REPORT_PERIOD     10         // summary period in seconds
+#define EPOLL_WAIT_MS     100
+#define MAX_EVENTS        1024
+
+enum rover_state { ROVER_IDLE, ROVER_CONNECTING, ROVER_CONNECTED, ROVER_CLOSED };
+
+struct load_rover {
+  int fd{-1};
+  rover_state state{ROVER_IDLE};
+  std::vector<double> LLA;
+  std::string sys_set;
+  uint64_t pos_sent_s{};
+  rtcm_checker checker;
+  epoch_histogram latency;
+  epoch_histogram jitter;
+  int64_t last_epoch_ms{-1};
+  int64_t last_arrival_us{};
+};
+
+struct loadgen_options {
+  const char *host{};
+  int port{};
+  int num_rovers{};
+  int duration_s{60};
+  int rate{500};  // connections started per second
+  double lat{33.96}, lon{-117.62}, radius_km{50.0};
+  const char *csv_path{};
+  unsigned seed{1};
+};
+
+// Current GPS time of week in microseconds
+static int64_t gps_tow_us() {
+  timeval tv{};
+  gettimeofday(&tv, nullptr);
+  int64_t sec = tv.tv_sec - GPST0_UNIX + GPS_LEAP_SEC;
+  return (sec % SEC_OF_WEEK) * 1000000LL + tv.tv_usec;
+}
+
+static int64_t monotonic_us() {
+  timespec ts{};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+// Random position within radius_km of the center, height 0-500 m
+static std::vector<double> random_position(const loadgen_options &opt,
+                                           std::mt19937 &rng) {
+  std::uniform_real_distribution<double> uni(0.0, 1.0);
+  double r = opt.radius_km * 1000.0 * sqrt(uni(rng));
+  double az = 2 * PI * uni(rng);
+  double dlat = r * cos(az) / R_WGS84 * 180 / PI;
+  double dlon = r * sin(az) / (R_WGS84 * cos(D2R(opt.lat))) * 180 / PI;
+  return {opt.lat + dlat, opt.lon + dlon, 500.0 * uni(rng)};
+}
+
+// Random system selection, e.g. "010301", at least one system enabled
+static std::string random_systems(std::mt19937 &rng) {
+  const int max_code[3] = {MAX_CODE_GPS, MAX_CODE_GAL, MAX_CODE_BDS};
+  std::uniform_real_distribution<double> uni(0.0, 1.0);
+  int code[3];
+  do {
+    for (int i = 0; i < 3; i++) {
+      code[i] = uni(rng) < 0.8 ? 1 + (int)(uni(rng) * max_code[i]) : 0;
+    }
+  } while (code[0] + code[1] + code[2] == 0);
+  char buf[8];
+  snprintf(buf, sizeof(buf), "%02d%02d%02d", code[0], code[1], code[2]);
+  return std::string(buf);
+}
+
+static void close_rover(int epfd, load_rover &rover) {
+  if (rover.fd != -1) {
+    epoll_ctl(epfd, EPOLL_CTL_DEL, rover.fd, nullptr);
+    close(rover.fd);
+    rover.fd = -1;
+  }
+  rover.state = ROVER_CLOSED;
+}
+
+// Send the position padded to RTCM_BUFSIZE, as VN_DGNSS_Client does
+static bool send_position(load_rover &rover) {
+  std::string pos_ecef = msg_to_server(rover.LLA, rover.sys_set);
+  char pos_buff[RTCM_BUFSIZE] = {0};
+  strncpy(pos_buff, pos_ecef.c_str(), RTCM_BUFSIZE - 1);
+  timeval tv{};
+  gettimeofday(&tv, nullptr);
+  rover.pos_sent_s = get_sec(tv);
+  return send(rover.fd, pos_buff, RTCM_BUFSIZE, MSG_NOSIGNAL) == RTCM_BUFSIZE;
+}
+
+static bool start_connect(int epfd, const sockaddr_in &addr, int id,
+                          load_rover &rover) {
+  rover.fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, IPPROTO_TCP);
+  if (rover.fd == -1) {
+    rover.state = ROVER_CLOSED;
+    return false;
+  }
+  if (connect(rover.fd, (const sockaddr *)&addr, sizeof(addr)) == -1 &&
+      errno != EINPROGRESS) {
+    close_rover(epfd, rover);
+    return false;
+  }
+  epoll_event ev{};
+  ev.events = EPOLLOUT | EPOLLIN;
+  ev.data.u32 = (uint32_t)id;
+  epoll_ctl(epfd, EPOLL_CTL_ADD, rover.fd, &ev);
+  rover.state = ROVER_CONNECTING;
+  return true;
+}
+
+// A MSM of a new epoch was received
+static void on_epoch(load_rover &rover, int64_t epoch_ms) {
+  int64_t now_tow = gps_tow_us();
+  int64_t now = monotonic_us();
+  int64_t latency = now_tow - epoch_ms * 1000;
+  // week rollover between the epoch and its arrival
+  if (latency < -(int64_t)SEC_OF_WEEK * 500000) {
+    latency += (int64_t)SEC_OF_WEEK * 1000000;
+  }
+  rover.latency.record(latency > 0 ? (uint64_t)latency : 0);
+  if (rover.last_epoch_ms >= 0) {
+    int64_t jitter = (now - rover.last_arrival_us) -
+                     (epoch_ms - rover.last_epoch_ms) * 1000;
+    rover.jitter.record((uint64_t)std::abs(jitter));
+  }
+  rover.last_epoch_ms = epoch_ms;
+  rover.last_arrival_us = now;
+}
+
+static void read_rover(int epfd, load_rover &rover) {
+  unsigned char buf[4096];
+  while (true) {
+    int ret = recv(rover.fd, buf, sizeof(buf), 0);
+    if (ret > 0) {
+      rover.checker.input(buf, ret, [&](const unsigned char *frame, int len) {
+        int64_t epoch_ms = msm_epoch_ms(frame, len);
+        if (epoch_ms >= 0 && epoch_ms != rover.last_epoch_ms) {
+          on_epoch(rover, epoch_ms);
+        }
+      });
+    } else if (ret == 0 || !(errno == EWOULDBLOCK || errno == EAGAIN ||
+                             errno == EINTR)) {
+      close_rover(epfd, rover);
+      return;
+    } else if (errno != EINTR) {
+      return;
+    }
+  }
+}
+
+static void print_summary(double elapsed, const std::vector<load_rover> &rovers) {
+  int num_state[4] = {0, 0, 0, 0};
+  uint64_t frames = 0, crc_errors = 0;
+  epoch_histogram latency, jitter;
+  for (const load_rover &rover : rovers) {
+    num_state[rover.state]++;
+    frames += rover.checker.frames;
+    crc_errors += rover.checker.crc_errors;
+    latency.merge(rover.latency);
+    jitter.merge(rover.jitter);
+  }
+  std::cout << std::fixed << std::setprecision(1) << "[" << elapsed
+            << " s] connected: " << num_state[ROVER_CONNECTED]
+            << " connecting: " << num_state[ROVER_CONNECTING]
+            << " closed: " << num_state[ROVER_CLOSED] << " frames: " << frames
+            << " crc errors: " << crc_errors << " epochs: " << latency.count()
+            << " latency ms p50/p99/max: " << latency.percentile(50) / 1000.0
+            << "/" << latency.percentile(99) / 1000.0 << "/"
+            << latency.max() / 1000.0
+            << " jitter ms p50/p99: " << jitter.percentile(50) / 1000.0 << "/"
+            << jitter.percentile(99) / 1000.0 << std::endl;
+}
+
+static void write_csv(const char *path, const std::vector<load_rover> &rovers) {
+  std::ofstream csv(path);
+  if (!csv.is_open()) {
+    std::cerr << local_tstr() << "open " << path << " failed" << std::endl;
+    return;
+  }
+  csv << "rover,systems,state,frames,crc_errors,epochs,latency_p50_ms,"
+         "latency_p99_ms,latency_max_ms,jitter_p50_ms,jitter_p99_ms\n";
+  csv << std::fixed << std::setprecision(3);
+  for (size_t i = 0; i < rovers.size(); i++) {
+    const load_rover &r = rovers[i];
+    csv << i << "," << r.sys_set << "," << r.state << "," << r.checker.frames
+        << "," << r.checker.crc_errors << "," << r.latency.count() << ","
+        << r.latency.percentile(50) / 1000.0 << ","
+        << r.latency.percentile(99) / 1000.0 << "," << r.latency.max() / 1000.0
+        << "," << r.jitter.percentile(50) / 1000.0 << ","
+        << r.jitter.percentile(99) / 1000.0 << "\n";
+  }
+}
+
+static void print_usage() {
+  std::cerr << "eg: ./VN_DGNSS_Loadgen Server_host Server_port Num_rovers "
+               "[--duration s] [--rate conn/s] [--center lat lon] "
+               "[--radius km] [--csv file] [--seed n]"
+            << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 4) {
+    print_usage();
+    exit(EXIT_FAILURE);
+  }
+  loadgen_options opt;
+  opt.host = argv[1];
+  opt.port = atoi(argv[2]);
+  opt.num_rovers = atoi(argv[3]);
+  for (int i = 4; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--duration" && i + 1 < argc) {
+      opt.duration_s = atoi(argv[++i]);
+    } else if (arg == "--rate" && i + 1 < argc) {
+      opt.rate = std::max(1, atoi(argv[++i]));
+    } else if (arg == "--center" && i + 2 < argc) {
+      opt.lat = atof(argv[++i]);
+      opt.lon = atof(argv[++i]);
+    } else if (arg == "--radius" && i + 1 < argc) {
+      opt.radius_km = atof(argv[++i]);
+    } else if (arg == "--csv" && i + 1 < argc) {
+      opt.csv_path = argv[++i];
+    } else if (arg == "--seed" && i + 1 < argc) {
+      opt.seed = (unsigned)atoi(argv[++i]);
+    } else {
+      print_usage();
+      exit(EXIT_FAILURE);
+    }
+  }
+  // Every rover takes a socket
+  struct rlimit fd_limit {};
+  if (getrlimit(RLIMIT_NOFILE, &fd_limit) == 0) {
+    fd_limit.rlim_cur = fd_limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &fd_limit);
+  }
+  addrinfo hints{}, *res = nullptr;
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(opt.host, nullptr, &hints, &res) != 0 || res == nullptr) {
+    std::cerr << local_tstr() << "The specified host is unknown." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  sockaddr_in addr = *(sockaddr_in *)res->ai_addr;
+  addr.sin_port = htons(opt.port);
+  freeaddrinfo(res);
+
+  std::mt19937 rng(opt.seed);
+  std::vector<load_rover> rovers(opt.num_rovers);
+  for (load_rover &rover : rovers) {
+    rover.LLA = random_position(opt, rng);
+    rover.sys_set = random_systems(rng);
+  }
+  int epfd = epoll_create1(0);
+  epoll_event events[MAX_EVENTS];
+  int64_t start = monotonic_us();
+  int64_t last_report = start;
+  int next_rover = 0;
+  while (true) {
+    int64_t now = monotonic_us();
+    double elapsed = (now - start) / 1e6;
+    if (elapsed >= opt.duration_s) break;
+    // Ramp up at opt.rate connections per second
+    int target = std::min(opt.num_rovers, (int)(elapsed * opt.rate) + 1);
+    for (; next_rover < target; next_rover++) {
+      start_connect(epfd, addr, next_rover, rovers[next_rover]);
+    }
+    int n = epoll_wait(epfd, events, MAX_EVENTS, EPOLL_WAIT_MS);
+    for (int i = 0; i < n; i++) {
+      load_rover &rover = rovers[events[i].data.u32];
+      if (rover.fd == -1) continue;
+      if (rover.state == ROVER_CONNECTING && (events[i].events & EPOLLOUT)) {
+        int err = 0;
+        socklen_t len = sizeof(err);
+        getsockopt(rover.fd, SOL_SOCKET, SO_ERROR, &err, &len);
+        if (err != 0 || !send_position(rover)) {
+          close_rover(epfd, rover);
+          continue;
+        }
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.u32 = events[i].data.u32;
+        epoll_ctl(epfd, EPOLL_CTL_MOD, rover.fd, &ev);
+        rover.state = ROVER_CONNECTED;
+      }
+      if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+        read_rover(epfd, rover);
+      }
+    }
+    // Send the position again every READ_PERIOD, as VN_DGNSS_Client does
+    timeval tv{};
+    gettimeofday(&tv, nullptr);
+    uint64_t now_s = get_sec(tv);
+    for (load_rover &rover : rovers) {
+      if (rover.state == ROVER_CONNECTED &&
+          now_s >= rover.pos_sent_s + READ_PERIOD && !send_position(rover)) {
+        close_rover(epfd, rover);
+      }
+    }
+    if (now - last_report >= REPORT_PERIOD * 1000000LL) {
+      print_summary(elapsed, rovers);
+      last_report = now;
+    }
+  }
+  print_summary((monotonic_us() - start) / 1e6, rovers);
+  if (opt.csv_path != nullptr) write_csv(opt.csv_path, rovers);
+  for (load_rover &rover : rovers) close_rover(epfd, rover);
+  close(epfd);
+  return 0;
+}
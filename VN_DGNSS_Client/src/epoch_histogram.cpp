@@ -0,0 +1,47 @@
+#include "epoch_histogram.h"
+
+int epoch_histogram::bucket_of(uint32_t value) {
+  if (value < (1u << SUB_BITS)) return (int)value;
+  int msb = 31 - __builtin_clz(value);
+  int shift = msb - SUB_BITS;
+  return ((shift + 1) << SUB_BITS) +
+         (int)((value >> shift) & ((1u << SUB_BITS) - 1));
+}
+
+uint32_t epoch_histogram::bucket_upper(int bucket) {
+  if (bucket < (1 << SUB_BITS)) return (uint32_t)bucket;
+  int shift = (bucket >> SUB_BITS) - 1;
+  uint64_t mantissa = (bucket & ((1 << SUB_BITS) - 1)) | (1 << SUB_BITS);
+  uint64_t upper = ((mantissa + 1) << shift) - 1;
+  return upper > UINT32_MAX ? UINT32_MAX : (uint32_t)upper;
+}
+
+void epoch_histogram::record(uint64_t value) {
+  uint32_t v = value > UINT32_MAX ? UINT32_MAX : (uint32_t)value;
+  counts[bucket_of(v)]++;
+  total++;
+  sum += v;
+  if (v > max_value) max_value = v;
+}
+
+void epoch_histogram::merge(const epoch_histogram &other) {
+  for (int i = 0; i < NUM_BUCKETS; i++) counts[i] += other.counts[i];
+  total += other.total;
+  sum += other.sum;
+  if (other.max_value > max_value) max_value = other.max_value;
+}
+
+uint32_t epoch_histogram::percentile(double p) const {
+  if (total == 0) return 0;
+  uint64_t rank = (uint64_t)(p / 100.0 * (double)total);
+  if (rank >= total) rank = total - 1;
+  uint64_t seen = 0;
+  for (int i = 0; i < NUM_BUCKETS; i++) {
+    seen += counts[i];
+    if (seen > rank) {
+      uint32_t upper = bucket_upper(i);
+      return upper < max_value ? upper : max_value;
+    }
+  }
+  return max_value;
+}
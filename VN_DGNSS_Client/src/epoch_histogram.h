@@ -0,0 +1,27 @@
+#ifndef WADGNSS_CLIENT_EPOCH_HISTOGRAM_H
+#define WADGNSS_CLIENT_EPOCH_HISTOGRAM_H
+#pragma once
+#include <cstdint>
+// Histogram of epoch latency or jitter (us) with 8 buckets per power of two,
+// i.e. values within 12.5%, small enough for one per simulated rover
+class epoch_histogram {
+private:
+  static constexpr int SUB_BITS = 3;
+  static constexpr int NUM_BUCKETS = (32 - SUB_BITS + 1) << SUB_BITS;
+  uint32_t counts[NUM_BUCKETS]{};
+  uint64_t total{};
+  uint64_t sum{};
+  uint32_t max_value{};
+  static int bucket_of(uint32_t value);
+  static uint32_t bucket_upper(int bucket);
+public:
+  void record(uint64_t value);
+  void merge(const epoch_histogram &other);
+  // Upper bound of the bucket holding the p-th percentile (0-100)
+  uint32_t percentile(double p) const;
+  uint64_t count() const { return total; }
+  uint32_t max() const { return max_value; }
+  double mean() const { return total ? (double)sum / total : 0.0; }
+};
+
+#endif  // WADGNSS_CLIENT_EPOCH_HISTOGRAM_H
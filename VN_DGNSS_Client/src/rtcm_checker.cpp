@@ -0,0 +1,38 @@
+#include "rtcm_checker.h"
+
+// CRC-24Q of RTCM 3 (polynomial 0x1864CFB)
+uint32_t crc24q(const unsigned char *buff, int len) {
+  uint32_t crc = 0;
+  for (int i = 0; i < len; i++) {
+    crc ^= (uint32_t)buff[i] << 16;
+    for (int j = 0; j < 8; j++) {
+      crc <<= 1;
+      if (crc & 0x1000000) crc ^= 0x1864CFB;
+    }
+  }
+  return crc & 0xFFFFFF;
+}
+
+// Unsigned bit field, pos and len in bits (len <= 32)
+uint32_t get_bitu(const unsigned char *buff, int pos, int len) {
+  uint32_t bits = 0;
+  for (int i = pos; i < pos + len; i++) {
+    bits = (bits << 1) | ((buff[i / 8] >> (7 - i % 8)) & 1u);
+  }
+  return bits;
+}
+
+int64_t msm_epoch_ms(const unsigned char *frame, int len) {
+  // header (24 bits), message type (12), station id (12), epoch time (30)
+  if (len < 3 + 10 + 3) return -1;
+  int type = (int)get_bitu(frame, 24, 12);
+  int64_t tow = get_bitu(frame, 48, 30);
+  if ((type >= 1071 && type <= 1077) || (type >= 1091 && type <= 1097)) {
+    return tow;
+  }
+  if (type >= 1121 && type <= 1127) {
+    // BDS time is 14 s behind GPS time
+    return (tow + 14000) % (604800 * 1000LL);
+  }
+  return -1;
+}
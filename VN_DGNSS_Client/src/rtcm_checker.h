@@ -0,0 +1,66 @@
+#ifndef WADGNSS_CLIENT_RTCM_CHECKER_H
+#define WADGNSS_CLIENT_RTCM_CHECKER_H
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#define RTCM3_PREAMB      0xD3
+#define RTCM3_MAX_FRAME   (3 + 1023 + 3)  // header + max payload + CRC-24Q
+uint32_t crc24q(const unsigned char *buff, int len);
+uint32_t get_bitu(const unsigned char *buff, int pos, int len);
+// GPS time of week (ms) of a MSM frame, -1 for other messages
+int64_t msm_epoch_ms(const unsigned char *frame, int len);
+
+// Split the RTCM 3 stream of the server into frames and check their CRC-24Q.
+// After a false preamble (reserved bits set or CRC error) the buffered bytes
+// are searched again from one byte past it, so a valid frame behind is kept.
+class rtcm_checker {
+private:
+  unsigned char buff[RTCM3_MAX_FRAME]{};
+  int nbyte{};
+  // Drop the first k buffered bytes and the bytes before the next preamble
+  void skip(int k) {
+    while (k < nbyte && buff[k] != RTCM3_PREAMB) k++;
+    memmove(buff, buff + k, nbyte - k);
+    nbyte -= k;
+  }
+  // Check the frames of the buffered bytes
+  template <typename F>
+  void parse(F &&on_frame) {
+    while (nbyte >= 3) {
+      int frame_len = (int)get_bitu(buff, 14, 10) + 3;
+      bool reserved_ok = (buff[1] & 0xFC) == 0;
+      if (reserved_ok && nbyte < frame_len + 3) return;
+      if (reserved_ok &&
+          crc24q(buff, frame_len) == get_bitu(buff, frame_len * 8, 24)) {
+        frames++;
+        on_frame((const unsigned char *)buff, frame_len + 3);
+        skip(frame_len + 3);
+        continue;
+      }
+      if (reserved_ok) crc_errors++;
+      int before = nbyte;
+      skip(1);
+      skipped_bytes += before - nbyte;
+    }
+  }
+public:
+  uint64_t frames{};
+  uint64_t crc_errors{};
+  // Bytes skipped while looking for a preamble
+  uint64_t skipped_bytes{};
+  // Feed received bytes, on_frame(frame, len) is called for each valid frame
+  template <typename F>
+  void input(const unsigned char *data, size_t n, F &&on_frame) {
+    for (size_t i = 0; i < n; i++) {
+      if (nbyte == 0 && data[i] != RTCM3_PREAMB) {
+        skipped_bytes++;
+        continue;
+      }
+      buff[nbyte++] = data[i];
+      parse(on_frame);
+    }
+  }
+};
+
+#endif  // WADGNSS_CLIENT_RTCM_CHECKER_H
@@ -0,0 +1,275 @@
+// Microbenchmarks of the per-epoch hot path on fixed synthetic ephemeris
+// and SSR corrections, reporting ns/op and heap allocations/op. Run from
+// the build directory like the server, the models are loaded from
+// TROP_MODEL_PATH and GEOID_MODEL_PATH.
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <new>
+
+#include "client_session.h"
+#include "sat_state_table.h"
+#include "server.h"
+
+// Heap allocations counted by the replaced operator new
+static std::atomic<uint64_t> num_allocs{0};
+
+// Every replaced operator new/delete goes through these two. Not inlined,
+// so GCC does not pair the free() with a new expression of the caller
+// (-Wmismatched-new-delete).
+__attribute__((noinline)) static void *CountedAlloc(size_t size) {
+  num_allocs.fetch_add(1, std::memory_order_relaxed);
+  return malloc(size == 0 ? 1 : size);
+}
+__attribute__((noinline)) static void CountedFree(void *p) { free(p); }
+
+void *operator new(size_t size) {
+  if (void *p = CountedAlloc(size)) return p;
+  throw std::bad_alloc();
+}
+void *operator new[](size_t size) {
+  if (void *p = CountedAlloc(size)) return p;
+  throw std::bad_alloc();
+}
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+  return CountedAlloc(size);
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+  return CountedAlloc(size);
+}
+void operator delete(void *p) noexcept { CountedFree(p); }
+void operator delete[](void *p) noexcept { CountedFree(p); }
+void operator delete(void *p, size_t) noexcept { CountedFree(p); }
+void operator delete[](void *p, size_t) noexcept { CountedFree(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+  CountedFree(p);
+}
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+  CountedFree(p);
+}
+
+// Counts the allocations of a benchmark loop into the allocs/op counter
+class AllocCounter {
+ public:
+  explicit AllocCounter(benchmark::State &state)
+      : state_(state), start_(num_allocs.load(std::memory_order_relaxed)) {}
+  ~AllocCounter() {
+    state_.counters["allocs/op"] = benchmark::Counter(
+        (double)(num_allocs.load(std::memory_order_relaxed) - start_),
+        benchmark::Counter::kAvgIterations);
+  }
+
+ private:
+  benchmark::State &state_;
+  uint64_t start_;
+};
+
+// Synthetic corrections of one epoch: every GPS/GAL/BDS MEO satellite with
+// a healthy ephemeris, SSR orbit/clock matching its IOD, code biases and a
+// SSR VTEC, at a fixed GPS time
+struct Fixture {
+  gtime_t gpst_now{};
+  std::vector<double> date_gps{2024, 5, 12, 10, 0, 0};
+  int doy = 132;
+  std::vector<double> user_pos;
+  GnssSystemInfo infor;
+  IggtropExperimentModel trop;
+  CorrectionStore store;
+  std::unique_ptr<SatStateTable> table;
+
+  Fixture() {
+    ClientSession session;
+    UseServerPosition(session);
+    user_pos = session.pos_ecef;
+    infor = session.infor;
+    gpst_now = epoch2time(date_gps.data());
+    trop = GetIggtropCorrDataFromFile(TROP_MODEL_PATH);
+    if (!trop.IsLoaded() || !GeoidModelHelper::LoadModel(GEOID_MODEL_PATH)) {
+      std::cerr << vntimefunc::GetLocalTimeString()
+                << "err: load models fail!" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    gtime_t ssr_time = timeadd(gpst_now, -5.0);
+    const int max_prn[3] = {32, 30, 46};
+    const double sqrt_a[3] = {5153.7, 5440.6, 5282.6};
+    for (int sys_i = 0; sys_i < 3; sys_i++) {
+      SatOrbitCorrEpoch &orbit = store.Orbit(sys_i).BeginWrite();
+      SatClockCorrEpoch &clock = store.Clock(sys_i).BeginWrite();
+      orbit = SatOrbitCorrEpoch();
+      clock = SatClockCorrEpoch();
+      orbit.time = clock.time = ssr_time;
+      // BDS MEO only, GEO/IGSO are skipped
+      for (int prn = sys_i == 2 ? 19 : 1; prn <= max_prn[sys_i]; prn++) {
+        satstruct::Ephemeris eph = MakeEphemeris(sys_i, prn, sqrt_a[sys_i]);
+        store.Eph(sys_i, prn).Publish(eph);
+        orbit.data_sv[prn].prn = clock.data_sv[prn].prn = prn;
+        orbit.data_sv[prn].IOD = clock.data_sv[prn].IOD = (int)eph.IODE;
+        orbit.data_sv[prn].dx_m = {0.05 * (prn % 7), -0.02, 0.01};
+        orbit.data_sv[prn].dv_m = {0.0001, 0.0, -0.0002};
+        clock.data_sv[prn].dt_corr_s = {1e-9 * (prn % 5), 0.0, 0.0};
+      }
+      store.Orbit(sys_i).Publish();
+      store.Clock(sys_i).Publish();
+    }
+    store.NotifyRingUpdate();
+    store.Update([&](CorrectionSnapshot &corr) {
+      VTecCorrection &vtec = corr.vtec_ssr;
+      vtec.received = true;
+      vtec.time = ssr_time;
+      vtec.nDeg = vtec.nOrd = 6;
+      vtec.height_m = 450000.0;
+      for (int n = 0; n <= vtec.nDeg; n++) {
+        for (int m = 0; m <= std::min(n, vtec.nOrd); m++) {
+          vtec.cos_coeffs[n][m] = 8.0 / (1 + n + m);
+          vtec.sin_coeffs[n][m] = m == 0 ? 0.0 : 2.0 / (1 + n + m);
+        }
+      }
+      for (int prn = 1; prn <= MAXPRNGPS; prn++) {
+        corr.code_bias.bias_GPS[VN_CODE_GPS_C1C][prn] = {prn, 1.5};
+      }
+      for (int prn = 1; prn <= MAXPRNGAL; prn++) {
+        corr.code_bias.bias_GAL[VN_CODE_GAL_C1C][prn] = {prn, -0.5};
+      }
+      for (int prn = 1; prn <= MAXPRNCMP; prn++) {
+        corr.code_bias.bias_BDS[VN_CODE_BDS_C2I][prn] = {prn, 2.0};
+      }
+    });
+    table = std::make_unique<SatStateTable>(store, gpst_now, date_gps, doy);
+  }
+
+  // Kepler orbit on 6 planes, the satellites spread along each plane
+  satstruct::Ephemeris MakeEphemeris(int sys_i, int prn, double sqrt_a) const {
+    satstruct::Ephemeris eph;
+    int week;
+    double sow = time2gpst(gpst_now, &week);
+    eph.prn = prn;
+    eph.weekNo = sys_i == 2 ? week - 1356 : week;
+    eph.toes = sys_i == 2 ? sow - 14.0 : sow;
+    eph.t_oc = eph.t_oe = gpst_now;
+    eph.IODE = eph.IODC = 10 + prn;
+    eph.svH = 0;
+    eph.data_src = sys_i == 1 ? 517 : 0;
+    eph.a_f0 = 1e-5 * ((prn % 11) - 5);
+    eph.a_f1 = 1e-12;
+    eph.sqrtA = sqrt_a;
+    eph.e = 0.005;
+    eph.i_0 = 55.0 * D2R;
+    eph.Omega_0 = 2 * PI * (prn % 6) / 6.0;
+    eph.OmegaDot = -8e-9;
+    eph.M_0 = 2 * PI * (prn / 6) / 8.0 + 0.3 * (prn % 6);
+    eph.omega = 0.5;
+    eph.Delta_n = 4.5e-9;
+    return eph;
+  }
+};
+
+static Fixture &GetFixture() {
+  static Fixture fixture;
+  return fixture;
+}
+
+// Light time of one satellite to one receiver, from the cached state
+static void BM_SolveLightTime(benchmark::State &state) {
+  Fixture &f = GetFixture();
+  const SatState &st = f.table->GetSatStates(0)[1];
+  double sat_pos[3], clk_m;
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    SatStateTable::SolveLightTime(st, SYS_GPS, f.user_pos, sat_pos, clk_m);
+    benchmark::DoNotOptimize(sat_pos);
+    benchmark::DoNotOptimize(clk_m);
+  }
+}
+BENCHMARK(BM_SolveLightTime);
+
+static void BM_SsrVtecStec(benchmark::State &state) {
+  Fixture &f = GetFixture();
+  const SatState &st = f.table->GetSatStates(0)[1];
+  std::vector<double> sat_pos(st.pos, st.pos + 3);
+  SsrVtecCorrectionModel vtec;
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vtec.stec(f.table->GetVtecEvaluator(),
+                                       f.gpst_now.sec, f.user_pos, sat_pos,
+                                       FREQL1));
+  }
+}
+BENCHMARK(BM_SsrVtecStec);
+
+static void BM_IggtropDelay(benchmark::State &state) {
+  Fixture &f = GetFixture();
+  IggtropCorrectionModel trop;
+  double llh[3];
+  ecef2pos(f.user_pos.data(), llh);
+  double lon = llh[1] < 0 ? 2 * PI + llh[1] : llh[1];
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(trop.IGGtropdelay(lon * R2D, llh[0] * R2D,
+                                               llh[2] / 1000, f.doy,
+                                               30.0 * D2R, f.trop));
+  }
+}
+BENCHMARK(BM_IggtropDelay);
+
+static void BM_GeoidHeight(benchmark::State &state) {
+  Fixture &f = GetFixture();
+  GeoidModelHelper geoid;
+  double llh[3];
+  ecef2pos(f.user_pos.data(), llh);
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(geoid.geoidh(llh[0], llh[1]));
+  }
+}
+BENCHMARK(BM_GeoidHeight);
+
+// Satellite states shared by the receivers of one epoch
+static void BM_SatStateTable(benchmark::State &state) {
+  Fixture &f = GetFixture();
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    SatStateTable table(f.store, f.gpst_now, f.date_gps, f.doy);
+    benchmark::DoNotOptimize(table.GetSatStates(0).data());
+  }
+}
+BENCHMARK(BM_SatStateTable);
+
+static void BM_ConstructGnssMeas(benchmark::State &state) {
+  Fixture &f = GetFixture();
+  std::ostream no_log(nullptr);
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    EpochGenerationHelper genRTCM(f.user_pos);
+    if (!genRTCM.ConstructGnssMeas(*f.table, no_log, f.infor, f.trop, 0)) {
+      state.SkipWithError("no epoch generated from the fixture");
+      break;
+    }
+    benchmark::DoNotOptimize(genRTCM.GetNumOfSat());
+  }
+}
+BENCHMARK(BM_ConstructGnssMeas);
+
+// Encoding part of CreateRtcmMsg (1005 + MSM4), without the send, as the
+// next epochs of one stream
+static void BM_EncodeRtcmMsg(benchmark::State &state) {
+  Fixture &f = GetFixture();
+  std::ostream no_log(nullptr);
+  RtcmStreamEncoder encoder;
+  EpochGenerationHelper genRTCM(f.user_pos);
+  if (!genRTCM.ConstructGnssMeas(*f.table, no_log, f.infor, f.trop, 0)) {
+    state.SkipWithError("no epoch generated from the fixture");
+    return;
+  }
+  std::vector<unsigned char> frame;
+  frame.reserve(kRtcmFrameReserve);
+  AllocCounter allocs(state);
+  for (auto _ : state) {
+    frame.clear();
+    genRTCM.EncodeRtcmMsg(encoder, frame);
+    benchmark::DoNotOptimize(frame.data());
+  }
+  state.counters["sats"] = genRTCM.GetNumOfSat();
+}
+BENCHMARK(BM_EncodeRtcmMsg);
+
+BENCHMARK_MAIN();
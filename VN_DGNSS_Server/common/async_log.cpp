@@ -0,0 +1,257 @@
+#include "async_log.h"
+
+#include <fcntl.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace vnlog {
+namespace {
+enum class Op : uint8_t { kText, kTruncate, kClose };
+
+struct Record {
+  int32_t sink;
+  uint16_t len;
+  Op op;
+  char text[kRecordText];
+};
+
+// Bounded MPMC queue (Vyukov) used with a single consumer: a producer
+// claims consecutive cells with one CAS, the cell sequences publish their
+// records
+class RecordQueue {
+ public:
+  static constexpr uint64_t kCapacity = 65536;
+
+  RecordQueue() {
+    for (uint64_t i = 0; i < kCapacity; i++) {
+      cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+  }
+  // Push count records, fill(rec, k) fills the k-th. All or none are
+  // queued.
+  template <typename F>
+  bool Push(uint64_t count, F &&fill) {
+    if (count == 0 || count > kCapacity) return count == 0;
+    uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      // The consumer frees the cells in order, so the others are free when
+      // the last one is
+      uint64_t last = pos + count - 1;
+      uint64_t seq =
+          cells_[last & (kCapacity - 1)].seq.load(std::memory_order_acquire);
+      int64_t dif = (int64_t)seq - (int64_t)last;
+      if (dif == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + count,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (dif < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    for (uint64_t k = 0; k < count; k++) {
+      Cell &cell = cells_[(pos + k) & (kCapacity - 1)];
+      fill(cell.rec, k);
+      cell.seq.store(pos + k + 1, std::memory_order_release);
+    }
+    return true;
+  }
+  // Consumer: the next record, nullptr if none. Release it with Pop.
+  const Record *Front() const {
+    const Cell &cell = cells_[dequeue_pos_ & (kCapacity - 1)];
+    if (cell.seq.load(std::memory_order_acquire) != dequeue_pos_ + 1) {
+      return nullptr;
+    }
+    return &cell.rec;
+  }
+  void Pop() {
+    cells_[dequeue_pos_ & (kCapacity - 1)].seq.store(
+        dequeue_pos_ + kCapacity, std::memory_order_release);
+    dequeue_pos_++;
+  }
+  uint64_t EnqueuePos() const {
+    return enqueue_pos_.load(std::memory_order_acquire);
+  }
+  uint64_t DequeuePos() const { return dequeue_pos_; }
+
+ private:
+  struct alignas(64) Cell {
+    std::atomic<uint64_t> seq;
+    Record rec;
+  };
+  static_assert(sizeof(Cell) == 256, "records are packed in 256 bytes");
+  Cell cells_[kCapacity];
+  alignas(64) std::atomic<uint64_t> enqueue_pos_{0};
+  alignas(64) uint64_t dequeue_pos_{0};
+};
+
+// Max records drained before the batches are written
+constexpr int kMaxBatch = 4096;
+// Sleep of the writer when the queue is empty (us)
+constexpr int kIdleSleep = 1000;
+
+RecordQueue *queue;
+std::atomic<uint64_t> num_dropped{0};
+// Queue position up to which the records are written
+std::atomic<uint64_t> written_pos{0};
+std::once_flag writer_started;
+
+void WriteAll(int fd, const std::string &data) {
+  for (size_t done = 0; done < data.size();) {
+    ssize_t ret = write(fd, data.data() + done, data.size() - done);
+    if (ret == -1 && errno == EINTR) continue;
+    if (ret <= 0) return;
+    done += ret;
+  }
+}
+
+void RunWriter() {
+  std::unordered_map<int, std::string> batches;
+  while (true) {
+    int n = 0;
+    const Record *rec;
+    while (n < kMaxBatch && (rec = queue->Front()) != nullptr) {
+      std::string &batch = batches[rec->sink];
+      if (rec->op == Op::kText) {
+        batch.append(rec->text, rec->len);
+      } else {
+        WriteAll(rec->sink, batch);
+        batch.clear();
+        if (rec->op == Op::kTruncate) {
+          if (ftruncate(rec->sink, 0) == -1) perror("truncate log");
+        } else {
+          close(rec->sink);
+          batches.erase(rec->sink);
+        }
+      }
+      queue->Pop();
+      n++;
+    }
+    for (auto &elem : batches) {
+      if (elem.second.empty()) continue;
+      WriteAll(elem.first, elem.second);
+      elem.second.clear();
+    }
+    written_pos.store(queue->DequeuePos(), std::memory_order_release);
+    if (n == 0) usleep(kIdleSleep);
+  }
+}
+
+void StartWriter() {
+  std::call_once(writer_started, [] {
+    queue = new RecordQueue();
+    std::thread(RunWriter).detach();
+    // Lines logged before exit() are not lost
+    atexit(Flush);
+  });
+}
+
+// Control records wait for room in the queue, they must not be lost
+void PushOp(int sink, Op op) {
+  while (!queue->Push(1, [&](Record &rec, uint64_t) {
+    rec.sink = sink;
+    rec.len = 0;
+    rec.op = op;
+  })) {
+    sched_yield();
+  }
+}
+}  // namespace
+
+int OpenSink(const std::string &path, bool append) {
+  int fd = open(path.c_str(),
+                O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC | (append ? 0 : O_TRUNC),
+                0644);
+  if (fd == -1) return -1;
+  StartWriter();
+  return fd;
+}
+
+void TruncateSink(int sink) {
+  if (sink >= 0) PushOp(sink, Op::kTruncate);
+}
+
+void CloseSink(int sink) {
+  if (sink >= 0) PushOp(sink, Op::kClose);
+}
+
+bool Write(int sink, const char *text, size_t n) {
+  uint64_t count = (n + kRecordText - 1) / kRecordText;
+  if (!queue->Push(count, [&](Record &rec, uint64_t k) {
+        size_t offset = k * kRecordText;
+        size_t len = std::min(n - offset, (size_t)kRecordText);
+        rec.sink = sink;
+        rec.len = (uint16_t)len;
+        rec.op = Op::kText;
+        memcpy(rec.text, text + offset, len);
+      })) {
+    num_dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+void Flush() {
+  if (queue == nullptr) return;
+  uint64_t target = queue->EnqueuePos();
+  while (written_pos.load(std::memory_order_acquire) < target) {
+    usleep(kIdleSleep / 2);
+  }
+}
+
+uint64_t GetNumDropped() {
+  return num_dropped.load(std::memory_order_relaxed);
+}
+
+LogBuf::int_type LogBuf::overflow(int_type c) {
+  Push();
+  if (!traits_type::eq_int_type(c, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+void LogBuf::Push() {
+  if (pptr() > pbase() && sink_ != -1) Write(sink_, pbase(), pptr() - pbase());
+  setp(buf_, buf_ + sizeof(buf_));
+}
+
+bool LogStream::Open(const std::string &path, bool append) {
+  Close();
+  int sink = OpenSink(path, append);
+  buf_.SetSink(sink);
+  if (sink == -1) setstate(std::ios::failbit);
+  else clear();
+  return sink != -1;
+}
+
+void LogStream::Close() {
+  int sink = buf_.GetSink();
+  if (sink == -1) return;
+  buf_.SetSink(-1);
+  CloseSink(sink);
+}
+
+void LogStream::Truncate() {
+  buf_.pubsync();
+  TruncateSink(buf_.GetSink());
+}
+
+std::ostream &ThreadStream(int sink) {
+  thread_local LogBuf buf;
+  thread_local std::ostream stream(&buf);
+  if (buf.GetSink() != sink) buf.SetSink(sink);
+  return stream;
+}
+}  // namespace vnlog
@@ -0,0 +1,93 @@
+#ifndef VN_DGNSS_SERVER_ASYNC_LOG_H
+#define VN_DGNSS_SERVER_ASYNC_LOG_H
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Lowest level of the log lines compiled in, set by the build
+#define VN_LOG_LEVEL_DEBUG 0
+#define VN_LOG_LEVEL_INFO 1
+#define VN_LOG_LEVEL_WARN 2
+#define VN_LOG_LEVEL_ERROR 3
+#ifndef VN_LOG_LEVEL
+#define VN_LOG_LEVEL VN_LOG_LEVEL_DEBUG
+#endif
+#define VN_LOG_ENABLED(level) ((level) >= VN_LOG_LEVEL)
+
+// Asynchronous log files. The lines are formatted by the calling thread
+// into fixed size records pushed to a lock-free multi-producer queue; one
+// writer thread drains it and writes the records of each file in batches.
+// The records of a line are claimed together, so a line of up to kMaxLine
+// bytes is never interleaved with the lines of other threads. When the
+// queue is full the whole line is dropped and counted, the caller never
+// blocks. The writer thread starts with the first sink, after any fork.
+namespace vnlog {
+// Text bytes of one record, longer lines take several records
+static constexpr int kRecordText = 240;
+// Longest line buffered whole by LogBuf, longer lines are queued in parts
+static constexpr int kMaxLine = 16 * kRecordText;
+
+// Open a log file, returns its sink or -1
+int OpenSink(const std::string &path, bool append);
+// Queued after the lines already written to the sink
+void TruncateSink(int sink);
+void CloseSink(int sink);
+// Queue text for a sink in consecutive records, false if dropped
+bool Write(int sink, const char *text, size_t n);
+// Block until the lines queued so far are written
+void Flush();
+uint64_t GetNumDropped();
+
+// Buffer of one line, queued on flush (std::endl) or when full
+class LogBuf : public std::streambuf {
+ public:
+  LogBuf() { setp(buf_, buf_ + sizeof(buf_)); }
+  int GetSink() const { return sink_; }
+  void SetSink(int sink) {
+    Push();
+    sink_ = sink;
+  }
+
+ protected:
+  int_type overflow(int_type c) override;
+  int sync() override {
+    Push();
+    return 0;
+  }
+
+ private:
+  char buf_[kMaxLine];
+  int sink_{-1};
+
+  void Push();
+};
+
+// Log file written by one thread at a time, e.g. the log of a client
+class LogStream : public std::ostream {
+ public:
+  LogStream() : std::ostream(nullptr) { rdbuf(&buf_); }
+  explicit LogStream(const std::string &path, bool append = true)
+      : LogStream() {
+    Open(path, append);
+  }
+  ~LogStream() override { Close(); }
+
+  bool Open(const std::string &path, bool append = true);
+  void Close();
+  // Empty the file, e.g. for the daily reset
+  void Truncate();
+  bool is_open() const { return buf_.GetSink() != -1; }
+
+ private:
+  LogBuf buf_;
+};
+
+// Stream of the calling thread to a shared sink. Terminate each line with
+// std::endl; the formatting flags persist between calls.
+std::ostream &ThreadStream(int sink);
+}  // namespace vnlog
+
+#endif  // VN_DGNSS_SERVER_ASYNC_LOG_H
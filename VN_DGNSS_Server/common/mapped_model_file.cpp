@@ -0,0 +1,141 @@
+#include "mapped_model_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+#include "time_common_func.h"
+
+constexpr char MappedModelFile::kMagic[8];
+
+MappedModelFile::~MappedModelFile() { Close(); }
+
+MappedModelFile::MappedModelFile(MappedModelFile &&other) noexcept
+    : base_(std::exchange(other.base_, nullptr)),
+      length_(std::exchange(other.length_, 0)) {}
+
+MappedModelFile &MappedModelFile::operator=(MappedModelFile &&other) noexcept {
+  if (this != &other) {
+    Close();
+    base_ = std::exchange(other.base_, nullptr);
+    length_ = std::exchange(other.length_, 0);
+  }
+  return *this;
+}
+
+void MappedModelFile::Close() {
+  if (base_ != nullptr) munmap(base_, length_);
+  base_ = nullptr;
+  length_ = 0;
+}
+
+uint64_t MappedModelFile::Checksum(const float *values, size_t count) {
+  const unsigned char *p = reinterpret_cast<const unsigned char *>(values);
+  uint64_t hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < count * sizeof(float); i++) {
+    hash ^= p[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+static uint64_t NumOfValues(const MappedModelHeader &header) {
+  if (header.num_dims == 0 ||
+      header.num_dims > (uint32_t)MappedModelHeader::kMaxDims) {
+    return 0;
+  }
+  uint64_t count = 1;
+  for (uint32_t i = 0; i < header.num_dims; i++) count *= header.dims[i];
+  return count;
+}
+
+bool MappedModelFile::Open(const std::string &path) {
+  Close();
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: open model "
+              << path << " fail! caused by " << strerror(errno) << std::endl;
+    return false;
+  }
+  struct stat st {};
+  if (fstat(fd, &st) == -1 ||
+      (size_t)st.st_size < sizeof(MappedModelHeader)) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: model " << path
+              << " too short" << std::endl;
+    close(fd);
+    return false;
+  }
+  void *base = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: map model "
+              << path << " fail! caused by " << strerror(errno) << std::endl;
+    return false;
+  }
+  base_ = base;
+  length_ = st.st_size;
+  const MappedModelHeader &header = Header();
+  uint64_t count = NumOfValues(header);
+  const char *err = nullptr;
+  if (memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+    err = " bad magic";
+  } else if (header.version != kVersion) {
+    err = " unsupported version";
+  } else if (count == 0 || count != header.num_values ||
+             length_ < sizeof(MappedModelHeader) + count * sizeof(float)) {
+    err = " bad dims";
+  } else if (Checksum(Data(), count) != header.checksum) {
+    err = " checksum mismatch";
+  }
+  if (err != nullptr) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: model " << path
+              << err << std::endl;
+    Close();
+    return false;
+  }
+  return true;
+}
+
+bool MappedModelFile::Create(const MappedModelHeader &header) {
+  Close();
+  uint64_t count = NumOfValues(header);
+  if (count == 0) return false;
+  size_t length = sizeof(MappedModelHeader) + count * sizeof(float);
+  void *base = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (base == MAP_FAILED) return false;
+  base_ = base;
+  length_ = length;
+  MappedModelHeader *h = static_cast<MappedModelHeader *>(base_);
+  *h = header;
+  memcpy(h->magic, kMagic, sizeof(kMagic));
+  h->version = kVersion;
+  h->num_values = count;
+  h->checksum = 0;
+  return true;
+}
+
+bool MappedModelFile::Write(const std::string &path) const {
+  if (!IsOpen()) return false;
+  MappedModelHeader header = Header();
+  header.checksum = Checksum(Data(), header.num_values);
+  std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char *>(Data()),
+            header.num_values * sizeof(float));
+  return (bool)out;
+}
+
+bool MappedModelFile::HasDims(uint32_t num_dims, const uint32_t *dims) const {
+  if (!IsOpen() || Header().num_dims != num_dims) return false;
+  for (uint32_t i = 0; i < num_dims; i++) {
+    if (Header().dims[i] != dims[i]) return false;
+  }
+  return true;
+}
@@ -0,0 +1,74 @@
+#ifndef VN_DGNSS_SERVER_MAPPED_MODEL_FILE_H
+#define VN_DGNSS_SERVER_MAPPED_MODEL_FILE_H
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Header of a model file (.vnm): a float grid with up to kMaxDims
+// dimensions, stored row-major after the header
+struct MappedModelHeader {
+  static constexpr int kMaxDims = 4;
+  char magic[8];
+  uint32_t version;
+  uint32_t num_dims;
+  // Size of each dimension, slowest first
+  uint32_t dims[kMaxDims];
+  // Grid coordinate of index 0 and step of each dimension
+  float origin[kMaxDims];
+  float spacing[kMaxDims];
+  uint64_t num_values;
+  // FNV-1a of the values
+  uint64_t checksum;
+  char reserved[48];
+};
+static_assert(sizeof(MappedModelHeader) == 128,
+              "values must stay cache line aligned");
+
+// Read-only memory mapped model file. Pages are shared with every process
+// mapping the same file. Models can also be built in memory with Create and
+// saved with Write.
+class MappedModelFile {
+ public:
+  static constexpr char kMagic[8] = "VNMODEL";
+  static constexpr uint32_t kVersion = 1;
+
+  MappedModelFile() = default;
+  ~MappedModelFile();
+  MappedModelFile(const MappedModelFile &) = delete;
+  MappedModelFile &operator=(const MappedModelFile &) = delete;
+  MappedModelFile(MappedModelFile &&other) noexcept;
+  MappedModelFile &operator=(MappedModelFile &&other) noexcept;
+
+  // Map a model file, check its header and checksum
+  bool Open(const std::string &path);
+  // Anonymous writable model with the dims/origin/spacing of header
+  bool Create(const MappedModelHeader &header);
+  // Save the model, with its checksum updated
+  bool Write(const std::string &path) const;
+  void Close();
+
+  bool IsOpen() const { return base_ != nullptr; }
+  const MappedModelHeader &Header() const {
+    return *static_cast<const MappedModelHeader *>(base_);
+  }
+  const float *Data() const {
+    return reinterpret_cast<const float *>(static_cast<const char *>(base_) +
+                                           sizeof(MappedModelHeader));
+  }
+  float *MutableData() {
+    return reinterpret_cast<float *>(static_cast<char *>(base_) +
+                                     sizeof(MappedModelHeader));
+  }
+  // True when the grid has exactly the given dims
+  bool HasDims(uint32_t num_dims, const uint32_t *dims) const;
+
+  static uint64_t Checksum(const float *values, size_t count);
+
+ private:
+  void *base_{};
+  size_t length_{};
+};
+
+#endif  // VN_DGNSS_SERVER_MAPPED_MODEL_FILE_H
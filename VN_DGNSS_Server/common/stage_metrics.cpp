@@ -0,0 +1,25 @@
+#include "stage_metrics.h"
+
+namespace vnmetrics {
+static LatencyHistogram stage_histograms[kNumStages];
+static std::atomic<int> num_of_sat[3];
+
+const char *StageName(Stage stage) {
+  static const char *const kNames[kNumStages] = {
+      "snapshot", "sat_states", "satellites", "iono",  "trop",
+      "encode",   "send",       "queue_delay", "epoch"};
+  return kNames[stage];
+}
+
+LatencyHistogram &StageHistogram(Stage stage) {
+  return stage_histograms[stage];
+}
+
+void SetNumOfSat(int sys_i, int num_sv) {
+  num_of_sat[sys_i].store(num_sv, std::memory_order_relaxed);
+}
+
+int GetNumOfSat(int sys_i) {
+  return num_of_sat[sys_i].load(std::memory_order_relaxed);
+}
+}  // namespace vnmetrics
@@ -0,0 +1,77 @@
+#ifndef VN_DGNSS_SERVER_STAGE_METRICS_H
+#define VN_DGNSS_SERVER_STAGE_METRICS_H
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Latency of the stages of the epoch pipeline, recorded from any thread
+// without locks and exported by the metrics endpoint of the server
+namespace vnmetrics {
+enum Stage {
+  // Satellite state table of the current second taken from the cache
+  kSnapshot,
+  // Satellite state table built from the corrections (once per second)
+  kSatStates,
+  // Per epoch: light time, geometry and observations, without iono/trop
+  kSatellites,
+  kIono,
+  kTrop,
+  kEncode,
+  // One sendmsg to a client
+  kSend,
+  // Client served after the start of its epoch second
+  kQueueDelay,
+  // Epoch of a client, from the cell cache or generated
+  kEpoch,
+  kNumStages
+};
+const char *StageName(Stage stage);
+
+// Power of two buckets from 1 us to 2^23 us (8.4 s), then +Inf
+class LatencyHistogram {
+ public:
+  static constexpr int kNumBuckets = 24;
+
+  void Record(uint64_t us) {
+    buckets_[Bucket(us)].fetch_add(1, std::memory_order_relaxed);
+    sum_us_.fetch_add(us, std::memory_order_relaxed);
+  }
+  // Count of bucket i (not cumulative), i == kNumBuckets for +Inf
+  uint64_t Count(int i) const {
+    return buckets_[i].load(std::memory_order_relaxed);
+  }
+  uint64_t SumUs() const { return sum_us_.load(std::memory_order_relaxed); }
+  static uint64_t UpperBoundUs(int i) { return 1ULL << i; }
+
+ private:
+  static int Bucket(uint64_t us) {
+    if (us <= 1) return 0;
+    int i = 64 - __builtin_clzll(us - 1);
+    return i < kNumBuckets ? i : kNumBuckets;
+  }
+  std::atomic<uint64_t> buckets_[kNumBuckets + 1]{};
+  std::atomic<uint64_t> sum_us_{0};
+};
+
+LatencyHistogram &StageHistogram(Stage stage);
+
+inline void RecordStage(Stage stage, uint64_t us) {
+  StageHistogram(stage).Record(us);
+}
+
+// Monotonic clock in microseconds for the stage timings
+inline uint64_t NowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Satellites with usable ephemeris and SSR in the latest state table,
+// per system (0 GPS, 1 GAL, 2 BDS)
+void SetNumOfSat(int sys_i, int num_sv);
+int GetNumOfSat(int sys_i);
+}  // namespace vnmetrics
+
+#endif  // VN_DGNSS_SERVER_STAGE_METRICS_H
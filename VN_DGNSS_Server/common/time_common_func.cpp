@@ -80,41 +80,52 @@ double GetSystemTimeInSec() {
   return (double)tv.tv_sec * 1000000 + tv.tv_usec;
 }
 
+// Simulated GPS time in seconds, used when simulated_gpst is set
+static std::atomic<bool> simulated_gpst{false};
+static std::atomic<int64_t> simulated_gpst_sec{0};
+
+void SetSimulatedGpsTime(gtime_t gpst_now) {
+  simulated_gpst_sec.store(gpst_now.time, std::memory_order_relaxed);
+  simulated_gpst.store(true, std::memory_order_release);
+}
+
+void ClearSimulatedGpsTime() {
+  simulated_gpst.store(false, std::memory_order_release);
+}
+
 void GetGpsTimeNow(std::vector<double> &date_time_gps, int &doy,
                    gtime_t &gpst_now) {
-  time_t tt;
-  struct tm *pt;
-  time(&tt);
-  pt = gmtime(&tt);
-  // cout<<"Current UTC time (hour:minute:sec): "<<pt->tm_hour<<"
-  // "<<pt->tm_min<<" "<<pt->tm_sec<<endl;
-  // rst << "Current UTC time (hour:minute:sec): " << pt->tm_hour << " "
-  //   << pt->tm_min << " " << pt->tm_sec << endl;
-  time_t rawtime;
-  struct tm *ptm;
-  time(&rawtime);
-  rawtime += 18;
-  ptm = gmtime(&rawtime);
-  date_time_gps[0] = ptm->tm_year + 1900;
-  date_time_gps[1] = ptm->tm_mon + 1;
-  date_time_gps[2] = ptm->tm_mday;
-  date_time_gps[3] = ptm->tm_hour;
-  date_time_gps[4] = ptm->tm_min;
-  date_time_gps[5] = ptm->tm_sec;
-  doy = ptm->tm_yday;
-  double epoch_gpst[6];
-  for (int i = 0; i < 6; i++) {
-    epoch_gpst[i] = date_time_gps[i];
+  if (simulated_gpst.load(std::memory_order_acquire)) {
+    gpst_now = {static_cast<time_t>(
+                    simulated_gpst_sec.load(std::memory_order_relaxed)),
+                0.0};
+  } else {
+    gpst_now = GpsTimeFromUtc(time(nullptr));
   }
-  gpst_now = epoch2time(epoch_gpst);
+  GpsTimeToDate(gpst_now, date_time_gps, doy);
+}
+
+void GpsTimeToDate(gtime_t gpst, std::vector<double> &date_time_gps,
+                   int &doy) {
+  // gmtime_r: called from every event loop
+  struct tm tm_gps {};
+  gmtime_r(&gpst.time, &tm_gps);
+  date_time_gps[0] = tm_gps.tm_year + 1900;
+  date_time_gps[1] = tm_gps.tm_mon + 1;
+  date_time_gps[2] = tm_gps.tm_mday;
+  date_time_gps[3] = tm_gps.tm_hour;
+  date_time_gps[4] = tm_gps.tm_min;
+  date_time_gps[5] = tm_gps.tm_sec;
+  doy = tm_gps.tm_yday;
 }
 
 // Get local time string
 std::string GetLocalTimeString() {
   time_t rawtime;
+  struct tm ltm_buf {};
   struct tm *ltm;
   time(&rawtime);
-  ltm = localtime(&rawtime);
+  ltm = localtime_r(&rawtime, &ltm_buf);
   char buf[28];
   sprintf(buf, "[%04d-%02d-%02d %02d:%02d:%02d]: ", ltm->tm_year + 1900,
           ltm->tm_mon + 1, ltm->tm_mday, ltm->tm_hour, ltm->tm_min,
@@ -125,9 +136,10 @@ std::string GetLocalTimeString() {
 // Get time string for file
 std::string GetLocalTimeStringForLog() {
   time_t rawtime;
+  struct tm ltm_buf {};
   struct tm *ltm;
   time(&rawtime);
-  ltm = localtime(&rawtime);
+  ltm = localtime_r(&rawtime, &ltm_buf);
   char buf[9];
   sprintf(buf, "%04d%02d%02d", ltm->tm_year + 1900, ltm->tm_mon + 1,
           ltm->tm_mday);
@@ -135,11 +147,10 @@ std::string GetLocalTimeStringForLog() {
 }
 
 int GetCurrentYear() {
-  time_t rawtime;
-  struct tm *ptm;
-  time(&rawtime);
-  ptm = gmtime(&rawtime);
-  return ptm->tm_year + 1900;
+  time_t rawtime = time(nullptr);
+  struct tm tm_utc {};
+  gmtime_r(&rawtime, &tm_utc);
+  return tm_utc.tm_year + 1900;
 }
 
 uint64_t GetSecFromTimeval(timeval tv) {
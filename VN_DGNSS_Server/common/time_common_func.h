@@ -4,6 +4,7 @@
 #include <sys/timerfd.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <fstream>
 #include <iostream>
 #include <mutex>
@@ -27,9 +28,22 @@ namespace vntimefunc {
 void DateToTimeOfWeek(std::vector<double> date_time, int &gps_week,
                       int &gps_dow, double &gps_sow);
 double LimitGpsTime(double time_diff);
+// Wall clock in microseconds since the epoch (not seconds)
 double GetSystemTimeInSec();
 void GetGpsTimeNow(std::vector<double> &date_time_gps, int &doy,
                    gtime_t &gpst_now);
+// GPS - UTC (s)
+constexpr int kGpsLeapSeconds = 18;
+// GPS time of a whole UTC second
+inline gtime_t GpsTimeFromUtc(time_t utc_sec) {
+  return {utc_sec + kGpsLeapSeconds, 0.0};
+}
+// Calendar date (GPS) and day of year of a GPS time
+void GpsTimeToDate(gtime_t gpst, std::vector<double> &date_time_gps,
+                   int &doy);
+// Replay: GetGpsTimeNow returns gpst_now (whole seconds) until cleared
+void SetSimulatedGpsTime(gtime_t gpst_now);
+void ClearSimulatedGpsTime();
 std::string GetLocalTimeString();
 std::string GetLocalTimeStringForLog();
 int GetCurrentYear();
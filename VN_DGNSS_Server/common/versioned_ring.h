@@ -0,0 +1,84 @@
+#ifndef VN_DGNSS_SERVER_VERSIONED_RING_H
+#define VN_DGNSS_SERVER_VERSIONED_RING_H
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// Fixed capacity history of the last N - 1 epochs of T, one writer and many
+// readers. The writer fills the slot of the next epoch in place while the
+// readers see the other N - 1; readers validate what they read with the
+// sequence counter of the slot (seqlock) and never block the writer.
+// Readers copy T while it may be written and rings may live in shared
+// memory, so T must be trivially copyable and own no heap memory.
+template <typename T, int N>
+class VersionedRing {
+ public:
+  static_assert(N >= 2, "one slot is always being written");
+  static_assert(std::is_trivially_copyable<T>::value,
+                "ring epochs are copied racily and may be shared memory");
+  // Number of epochs readers can see
+  static constexpr int kDepth = N - 1;
+
+  VersionedRing() = default;
+  VersionedRing(const VersionedRing &) = delete;
+  VersionedRing &operator=(const VersionedRing &) = delete;
+
+  // Writer: slot of the next epoch, hidden from the readers until Publish.
+  // Calling it again without Publish returns the same slot.
+  T &BeginWrite() {
+    uint64_t gen = head_.load(std::memory_order_relaxed);
+    Slot &slot = slots_[gen % N];
+    slot.seq.store(2 * gen + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    return slot.value;
+  }
+  // Writer: make the slot of BeginWrite the latest epoch
+  void Publish() {
+    uint64_t gen = head_.load(std::memory_order_relaxed);
+    slots_[gen % N].seq.store(2 * gen + 2, std::memory_order_release);
+    head_.store(gen + 1, std::memory_order_release);
+  }
+  // Writer: latest epoch, no validation needed as nothing else writes
+  const T *Latest() const {
+    uint64_t gen = head_.load(std::memory_order_relaxed);
+    return gen == 0 ? nullptr : &slots_[(gen - 1) % N].value;
+  }
+
+  // Reader: call fn(const T &) on the epoch age epochs before the latest.
+  // fn must only copy out what it needs; its result is valid only when true
+  // is returned. Returns false when the epoch does not exist or was recycled
+  // by the writer meanwhile.
+  template <typename F>
+  bool Read(int age, F &&fn) const {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    if (age < 0 || age >= kDepth || (uint64_t)age >= head) return false;
+    return ReadGeneration(head - 1 - age, std::forward<F>(fn));
+  }
+  // Reader: as Read, for the epoch published as the gen-th (from 0)
+  template <typename F>
+  bool ReadGeneration(uint64_t gen, F &&fn) const {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    if (gen >= head || head - gen > (uint64_t)kDepth) return false;
+    const Slot &slot = slots_[gen % N];
+    uint64_t seq = slot.seq.load(std::memory_order_acquire);
+    if (seq != 2 * gen + 2) return false;
+    fn(slot.value);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.seq.load(std::memory_order_relaxed) == seq;
+  }
+  // Number of epochs published so far
+  uint64_t Count() const { return head_.load(std::memory_order_acquire); }
+
+ private:
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> seq{0};
+    T value{};
+  };
+  Slot slots_[N];
+  std::atomic<uint64_t> head_{0};
+};
+
+#endif  // VN_DGNSS_SERVER_VERSIONED_RING_H
@@ -0,0 +1,86 @@
+// Conversion of the source model data to the .vnm files mapped by the
+// server (TROP_MODEL_PATH and GEOID_MODEL_PATH):
+//   ./VN_DGNSS_ModelConv ztd IGGtropSHexpModel.ztd IGGtropSHexpModel.vnm
+//   ./VN_DGNSS_ModelConv geoid EGM96Geoid.txt EGM96Geoid.vnm
+// The geoid text grid starts with "nlon nlat lon0 dlon lat0 dlat" (deg),
+// followed by the nlat heights (m) of every longitude, '#' lines ignored.
+#include <sstream>
+
+#include "geoid_model_helper.h"
+#include "iggtrop_correction_model.h"
+#include "time_common_func.h"
+
+static void PrintUsage() {
+  std::cerr << "eg: ./VN_DGNSS_ModelConv ztd|geoid input output.vnm"
+            << std::endl;
+}
+
+// Read the geoid text grid into an anonymous model
+static bool ReadGeoidGrid(const std::string &path, MappedModelFile &model) {
+  std::ifstream in(path);
+  if (!in.is_open()) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: open " << path
+              << " fail!" << std::endl;
+    return false;
+  }
+  std::stringstream values;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!line.empty() && line[0] != '#') values << line << '\n';
+  }
+  uint32_t nlon = 0, nlat = 0;
+  float lon0, dlon, lat0, dlat;
+  if (!(values >> nlon >> nlat >> lon0 >> dlon >> lat0 >> dlat) || nlon < 2 ||
+      nlat < 2) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: " << path
+              << " has no valid grid header!" << std::endl;
+    return false;
+  }
+  MappedModelHeader header{};
+  header.num_dims = 2;
+  header.dims[0] = nlon;
+  header.dims[1] = nlat;
+  header.origin[0] = lon0;
+  header.origin[1] = lat0;
+  header.spacing[0] = dlon;
+  header.spacing[1] = dlat;
+  if (!model.Create(header)) return false;
+  float *grid = model.MutableData();
+  const uint64_t count = model.Header().num_values;
+  for (uint64_t i = 0; i < count; i++) {
+    if (!(values >> grid[i])) {
+      std::cerr << vntimefunc::GetLocalTimeString() << "err: " << path
+                << " has " << i << " of " << count << " values!" << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 4) {
+    PrintUsage();
+    exit(EXIT_FAILURE);
+  }
+  std::string kind = argv[1];
+  MappedModelFile geoid;
+  const MappedModelFile *model = nullptr;
+  IggtropExperimentModel trop;
+  if (kind == "ztd") {
+    trop = GetIggtropCorrDataFromFile(argv[2]);
+    if (trop.IsLoaded()) model = &trop.file;
+  } else if (kind == "geoid") {
+    if (ReadGeoidGrid(argv[2], geoid)) model = &geoid;
+  } else {
+    PrintUsage();
+    exit(EXIT_FAILURE);
+  }
+  if (model == nullptr || !model->Write(argv[3])) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: convert "
+              << argv[2] << " to " << argv[3] << " fail!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::cout << argv[3] << ": " << model->Header().num_values << " values"
+            << std::endl;
+  return 0;
+}
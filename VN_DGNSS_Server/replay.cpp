@@ -0,0 +1,157 @@
+// Deterministic replay of the BKG streams recorded by the server
+// (--capture), for profiling and regression of the epoch pipeline without
+// the live feeds. The records are fed to BkgDataRequestor in their order
+// of reception while a simulated GPS clock steps through the capture, and
+// every simulated second the epochs of the virtual receivers are built and
+// encoded as the server does, as fast as possible.
+#include <zlib.h>
+
+#include <chrono>
+
+#include "client_session.h"
+#include "sat_state_table.h"
+#include "server.h"
+#include "stream_capture.h"
+
+static void PrintUsage() {
+  std::cerr << "eg: ./VN_DGNSS_Replay capture code_bias phase_bias "
+               "[--receivers N] [--out FILE]"
+            << std::endl;
+}
+
+// Virtual receivers on a square grid of cells around the server position
+static std::vector<std::vector<double>> MakeReceivers(int num_receivers) {
+  ClientSession center;
+  UseServerPosition(center);
+  double pos[3];
+  ecef2pos(center.pos_ecef.data(), pos);
+  int side = (int)std::ceil(std::sqrt((double)num_receivers));
+  std::vector<std::vector<double>> receivers;
+  for (int i = 0; i < num_receivers; i++) {
+    double llh[3] = {
+        pos[0] + (i / side - side / 2) * VRS_CELL_SIZE_DEG * D2R,
+        pos[1] + (i % side - side / 2) * VRS_CELL_SIZE_DEG * D2R, pos[2]};
+    std::vector<double> ecef(3);
+    pos2ecef(llh, ecef.data());
+    receivers.push_back(ecef);
+  }
+  return receivers;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 4) {
+    PrintUsage();
+    exit(EXIT_FAILURE);
+  }
+  int num_receivers = 1;
+  const char *out_path = nullptr;
+  for (int i = 4; i < argc; i++) {
+    if (strcmp(argv[i], "--receivers") == 0 && i + 1 < argc) {
+      num_receivers = std::max(1, atoi(argv[++i]));
+    } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      out_path = argv[++i];
+    } else {
+      PrintUsage();
+      exit(EXIT_FAILURE);
+    }
+  }
+  StreamCaptureReader reader;
+  if (!reader.Open(argv[1])) exit(EXIT_FAILURE);
+  // Epoch lines: GPS week, seconds of week, receiver, no. of sv, RTCM size
+  // and CRC-32 of the RTCM frame
+  std::ofstream out;
+  if (out_path != nullptr) {
+    out.open(out_path);
+    if (!out.is_open()) {
+      std::cerr << vntimefunc::GetLocalTimeString() << "err: open "
+                << out_path << " fail!" << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+  IggtropExperimentModel TropData = GetIggtropCorrDataFromFile(TROP_MODEL_PATH);
+  if (!TropData.IsLoaded() || !GeoidModelHelper::LoadModel(GEOID_MODEL_PATH)) {
+    std::cerr << vntimefunc::GetLocalTimeString()
+              << "err: load models fail!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  CorrectionStore corr_store;
+  // The requestors are fed directly, their threads are not started
+  std::string FOLDER_PATH = "../Log/";
+  BkgDataRequestor bkg(FOLDER_PATH, &corr_store);
+  WebDataRequestor web(FOLDER_PATH, &corr_store);
+  if (!web.LoadBiasFile(argv[2], false) || !web.LoadBiasFile(argv[3], true)) {
+    exit(EXIT_FAILURE);
+  }
+  ClientSession session;
+  UseServerPosition(session);
+  std::vector<std::vector<double>> receivers = MakeReceivers(num_receivers);
+  // One RTCM stream per receiver, as per VRS cell in the server
+  std::vector<std::unique_ptr<RtcmStreamEncoder>> encoders;
+  for (int i = 0; i < num_receivers; i++) {
+    encoders.push_back(std::make_unique<RtcmStreamEncoder>());
+  }
+  SatStateCache sat_states;
+  std::ostream no_log(nullptr);
+
+  uint64_t num_records = 0, num_bytes = 0, num_epochs = 0, num_valid = 0,
+           num_frame_bytes = 0;
+  // Build and encode the epochs of every receiver at the simulated time
+  auto run_epoch = [&](gtime_t gpst) {
+    vntimefunc::SetSimulatedGpsTime(gpst);
+    std::shared_ptr<const SatStateTable> table = sat_states.Acquire(corr_store);
+    int week;
+    double sow = time2gpst(gpst, &week);
+    for (int i = 0; i < num_receivers; i++) {
+      EpochGenerationHelper genRTCM(receivers[i]);
+      std::vector<unsigned char> frame;
+      bool valid = genRTCM.ConstructGnssMeas(*table, no_log, session.infor,
+                                             TropData, 0) &&
+                   genRTCM.EncodeRtcmMsg(*encoders[i], frame);
+      num_epochs++;
+      if (!valid) continue;
+      num_valid++;
+      num_frame_bytes += frame.size();
+      if (out.is_open()) {
+        out << week << ' ' << (int)sow << ' ' << i << ' '
+            << genRTCM.GetNumOfSat() << ' ' << frame.size() << ' ' << std::hex
+            << crc32(0, frame.data(), frame.size()) << std::dec << '\n';
+      }
+    }
+  };
+
+  auto wall_start = std::chrono::steady_clock::now();
+  CaptureStream stream;
+  gtime_t record_time{}, first_time{}, next_epoch{};
+  std::vector<char> data;
+  while (reader.Next(stream, record_time, data)) {
+    if (num_records++ == 0) {
+      first_time = record_time;
+      next_epoch.time = record_time.time + 1;
+    }
+    // Epochs due before this record was received
+    while (next_epoch.time <= record_time.time) {
+      run_epoch(next_epoch);
+      next_epoch.time++;
+    }
+    vntimefunc::SetSimulatedGpsTime(record_time);
+    bkg.InputStream(stream, data.data(), data.size());
+    num_bytes += data.size();
+  }
+  double wall_sec = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - wall_start)
+                        .count();
+  double sim_sec = num_records > 0 ? timediff(record_time, first_time) : 0.0;
+  vntimefunc::ClearSimulatedGpsTime();
+
+  std::cout << "records: " << num_records << " (" << num_bytes << " bytes)"
+            << std::endl;
+  std::cout << "simulated: " << sim_sec << " s, wall: " << wall_sec << " s, "
+            << (wall_sec > 0 ? sim_sec / wall_sec : 0.0) << "x real time"
+            << std::endl;
+  std::cout << "epochs: " << num_epochs << ", valid: " << num_valid
+            << ", RTCM bytes: " << num_frame_bytes << ", "
+            << (wall_sec > 0 ? num_epochs / wall_sec : 0.0) << " epochs/s"
+            << std::endl;
+  return 0;
+}
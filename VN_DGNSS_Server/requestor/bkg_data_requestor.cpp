@@ -1,12 +1,19 @@
 
 #include "bkg_data_requestor.h"
 
+#include "correction_snapshot.h"
+
 // IP for BKG data output
 static constexpr const char *kLocalIp = "127.0.0.1";
 // IP port for Eph data
 static constexpr int kEphPort = 3536;
+// IP port for the raw RTCM 3 ephemeris stream
+static constexpr int kEphRtcmPort = 3537;
 // IP port for SSR data
 static constexpr int kSsrPort = 6699;
+// IP ports for the raw RTCM 3 SSR streams, orbit/clock and biases/VTEC
+static constexpr int kWhuRtcmPort = 6697;
+static constexpr int kCneRtcmPort = 6698;
 // the request SSR&EPH interval, 0.1s
 static constexpr int kRequestInterval = 100000;
 // log period of IGS corr data in seconds
@@ -36,438 +43,356 @@ void BkgDataRequestor::ClearInputStream(std::stringstream &ss,
   ss << line;
 }
 
-static SatClockPara ParseClockCorrElement(const std::string &line) {
-  std::stringstream ss(line);
-  SatClockPara new_element;
-  ss >> new_element.prn >> new_element.IOD;
-  for (auto &corr : new_element.dt_corr_s) {
-    ss >> corr;
+// Start writing the next epoch of a SSR ring, with no satellite in it
+template <typename Ring>
+static auto &ResetSsrEpoch(Ring &ring) {
+  auto &epoch = ring.BeginWrite();
+  for (auto &sv : epoch.data_sv) {
+    sv.prn = -1;
   }
-  return new_element;
+  return epoch;
 }
 
-static SatOrbitPara ParseOrbitCorrElement(const std::string &line) {
-  std::stringstream ss(line);
-  SatOrbitPara new_element;
-  ss >> new_element.prn >> new_element.IOD;
-  for (auto &dx : new_element.dx_m) {
-    ss >> dx;
-  }
-  for (auto &dv : new_element.dv_m) {
-    ss >> dv;
+template <typename Bias>
+static void ResetBiasEpoch(Bias &bias, const SsrBlockHeader &header) {
+  std::copy(header.datetime, header.datetime + 6, bias.datetime.begin());
+  bias.time = header.time;
+  for (auto &sv : bias.data) {
+    sv.prn = -1;
+    for (auto &ele : sv.bias_ele) {
+      ele = BiasElement();
+    }
   }
-  return new_element;
 }
-void BkgDataRequestor::SsrVTecParser(VTecCorrection &new_vtec,
-                                     std::stringstream &ssr_ss,
-                                     std::string line) {
-  std::stringstream line_ss(line);
-  int dummy;
-  line_ss >> dummy >> new_vtec.nDeg >> new_vtec.nOrd >> new_vtec.height_m;
-  new_vtec.sin_coeffs.resize(new_vtec.nDeg + 1);
-  new_vtec.cos_coeffs.resize(new_vtec.nDeg + 1);
-  for (int nn = 0; nn <= new_vtec.nDeg; nn++) {
-    new_vtec.sin_coeffs[nn].resize(new_vtec.nOrd + 1);
-    new_vtec.cos_coeffs[nn].resize(new_vtec.nOrd + 1);
-  }
-  for (int iDeg = 0; iDeg <= new_vtec.nDeg; iDeg++) {
-    getline(ssr_ss, line);
-    ClearInputStream(line_ss, line);
-    for (int iOrd = 0; iOrd <= new_vtec.nOrd; iOrd++) {
-      line_ss >> new_vtec.cos_coeffs[iDeg][iOrd];
-    }
+
+// System index (0 GPS, 1 GAL, 2 BDS) of a system letter, -1 if not used
+static int SsrSysIndex(char sys) {
+  switch (sys) {
+    case 'G':
+      return 0;
+    case 'E':
+      return 1;
+    case 'C':
+      return 2;
+    default:
+      return -1;
   }
-  for (int iDeg = 0; iDeg <= new_vtec.nDeg; iDeg++) {
-    getline(ssr_ss, line);
-    ClearInputStream(line_ss, line);
-    for (int iOrd = 0; iOrd <= new_vtec.nOrd; iOrd++) {
-      line_ss >> new_vtec.sin_coeffs[iDeg][iOrd];
-    }
+}
+
+// Bias element of a code, -1 if not used. Due to the limitation in
+// phase_bias only parse 1C and 2W for GPS, 1x and 7x for GAL, 2I and 7I for
+// BDS
+static int SsrBiasIndex(int sys_i, std::string_view code) {
+  if (sys_i == 0) {
+    if (code == "1C") return VN_CODE_GPS_C1C;
+    if (code == "2W") return VN_CODE_GPS_C2W;
+  } else if (sys_i == 1) {
+    if (code == "1X") return VN_CODE_GAL_C1X;
+    if (code == "7X") return VN_CODE_GAL_C7X;
+  } else if (sys_i == 2) {
+    if (code == "2I") return VN_CODE_BDS_C2I;
+    if (code == "7I" || code == "7Z") return VN_CODE_BDS_C7;
   }
+  return -1;
 }
 
-static void ParseSsrCodeBiasCorr(SatCodeBiasPara &new_element,
-                                 const std::string &line,
-                                 const std::string &sys) {
-  // Due to the limitation in phase_bias
-  // only parse 1C and 2W for GPS, 1x and 7x for GAL, 2I and 7I for BDS
-  std::stringstream line_ss(line);
-  int prn, num;
-  line_ss >> prn >> num;
-  if (prn > 0) {
-    new_element.prn = prn;
+SsrCorrectionWriter::SsrCorrectionWriter(CorrectionStore *store)
+    : store_(store) {}
+
+bool SsrCorrectionWriter::OnBlockBegin(const SsrBlockHeader &header) {
+  // Orbit/clock from WHU, VTEC and biases from CNE
+  switch (header.type) {
+    case SsrBlockType::kClock:
+    case SsrBlockType::kOrbit:
+      if (header.mountpoint.find(kWhuStream) == std::string_view::npos) {
+        return false;
+      }
+      break;
+    default:
+      if (header.mountpoint.find(kCneStream) == std::string_view::npos) {
+        return false;
+      }
+      break;
   }
-  if (num > 0) {
-    for (int i = 0; i < num; i++) {
-      std::string code;
-      double value;
-      line_ss >> code >> value;
-      if (sys == "G") {
-        if (code == "1C") {
-          new_element.bias_ele[VN_CODE_GPS_C1C].received = true;
-          new_element.bias_ele[VN_CODE_GPS_C1C].value = value;
-        } else if (code == "2W") {
-          new_element.bias_ele[VN_CODE_GPS_C2W].received = true;
-          new_element.bias_ele[VN_CODE_GPS_C2W].value = value;
-        }
-      } else if (sys == "E") {
-        if (code == "1X") {
-          new_element.bias_ele[VN_CODE_GAL_C1X].received = true;
-          new_element.bias_ele[VN_CODE_GAL_C1X].value = value;
-        } else if (code == "7X") {
-          new_element.bias_ele[VN_CODE_GAL_C7X].received = true;
-          new_element.bias_ele[VN_CODE_GAL_C7X].value = value;
-        }
-      } else if (sys == "C") {
-        if (code == "2I") {
-          new_element.bias_ele[VN_CODE_BDS_C2I].received = true;
-          new_element.bias_ele[VN_CODE_BDS_C2I].value = value;
-        } else if (code == "7I" || code == "7Z") {
-          new_element.bias_ele[VN_CODE_BDS_C7].received = true;
-          new_element.bias_ele[VN_CODE_BDS_C7].value = value;
-        }
+  bool *got = got_[(int)header.type];
+  for (int sys_i = 0; sys_i < 3; sys_i++) {
+    got[sys_i] = false;
+    switch (header.type) {
+      case SsrBlockType::kClock: {
+        SatClockCorrEpoch &clk = ResetSsrEpoch(store_->Clock(sys_i));
+        std::copy(header.datetime, header.datetime + 6, clk.datetime.begin());
+        clk.time = header.time;
+        break;
       }
+      case SsrBlockType::kOrbit: {
+        SatOrbitCorrEpoch &obt = ResetSsrEpoch(store_->Orbit(sys_i));
+        std::copy(header.datetime, header.datetime + 6, obt.datetime.begin());
+        obt.time = header.time;
+        break;
+      }
+      case SsrBlockType::kCodeBias:
+        ResetBiasEpoch(SysOf(code_bias_, sys_i), header);
+        break;
+      case SsrBlockType::kPhaseBias:
+        ResetBiasEpoch(SysOf(phase_bias_, sys_i), header);
+        for (auto &sv : SysOf(phase_bias_, sys_i).data) {
+          sv.yawdeg = sv.yawdeg_rate = 0.0;
+        }
+        break;
+      default:
+        break;
     }
   }
+  if (header.type == SsrBlockType::kVtec) got_vtec_ = false;
+  return true;
 }
-static void ParseSsrPhaseBiasCorr(SatPhaseBiasPara &new_element,
-                                  const std::string &line,
-                                  const std::string &sys) {
-  // Due to the limitation in phase_bias
-  // only parse 1C and 2W for GPS, 1x and 7x for GAL, 2I and 7I for BDS
-  std::stringstream line_ss(line);
-  int prn, num;
-  double yaw, yawrate;
-  line_ss >> prn >> yaw >> yawrate >> num;
-  if (prn > 0) {
-    new_element.prn = prn;
-    new_element.yawdeg = yaw;
-    new_element.yawdeg_rate = yawrate;
-  }
-  if (num > 0) {
-    for (int i = 0; i < num; i++) {
-      std::string code;
-      double value, ind1, ind2, ind3;
-      line_ss >> code >> value >> ind1 >> ind2 >> ind3;
-      if (sys == "G") {
-        if (code == "1C") {
-          new_element.bias_ele[VN_CODE_GPS_C1C].received = true;
-          new_element.bias_ele[VN_CODE_GPS_C1C].value = value;
-        } else if (code == "2W") {
-          new_element.bias_ele[VN_CODE_GPS_C2W].received = true;
-          new_element.bias_ele[VN_CODE_GPS_C2W].value = value;
-        }
-      } else if (sys == "E") {
-        if (code == "1X") {
-          new_element.bias_ele[VN_CODE_GAL_C1X].received = true;
-          new_element.bias_ele[VN_CODE_GAL_C1X].value = value;
-        } else if (code == "7X") {
-          new_element.bias_ele[VN_CODE_GAL_C7X].received = true;
-          new_element.bias_ele[VN_CODE_GAL_C7X].value = value;
-        }
-      } else if (sys == "C") {
-        if (code == "2I") {
-          new_element.bias_ele[VN_CODE_BDS_C2I].received = true;
-          new_element.bias_ele[VN_CODE_BDS_C2I].value = value;
-        } else if (code == "7I" || code == "7Z") {
-          new_element.bias_ele[VN_CODE_BDS_C7].received = true;
-          new_element.bias_ele[VN_CODE_BDS_C7].value = value;
-        }
+
+void SsrCorrectionWriter::OnSatRecord(const SsrBlockHeader &header,
+                                      const SsrSatRecord &record) {
+  int sys_i = SsrSysIndex(record.sys);
+  const int max_prn[3] = {MAXPRNGPS, MAXPRNGAL, MAXPRNCMP};
+  if (sys_i < 0 || record.prn < 1 || record.prn > max_prn[sys_i]) return;
+  switch (header.type) {
+    case SsrBlockType::kClock: {
+      SatClockPara &sv =
+          store_->Clock(sys_i).BeginWrite().data_sv[record.prn];
+      sv.prn = record.prn;
+      sv.IOD = record.iod;
+      for (int k = 0; k < 3; k++) {
+        sv.dt_corr_s[k] = record.values[k];
+      }
+      break;
+    }
+    case SsrBlockType::kOrbit: {
+      SatOrbitPara &sv = store_->Orbit(sys_i).BeginWrite().data_sv[record.prn];
+      sv.prn = record.prn;
+      sv.IOD = record.iod;
+      for (int k = 0; k < 3; k++) {
+        sv.dx_m[k] = record.values[k];
+        sv.dv_m[k] = record.values[3 + k];
+      }
+      break;
+    }
+    case SsrBlockType::kCodeBias: {
+      SatCodeBiasPara &sv = SysOf(code_bias_, sys_i).data[record.prn];
+      sv.prn = record.prn;
+      for (int i = 0; i < record.num_bias; i++) {
+        int idx = SsrBiasIndex(sys_i, record.bias[i].code);
+        if (idx < 0) continue;
+        sv.bias_ele[idx].received = true;
+        sv.bias_ele[idx].value = record.bias[i].value;
       }
+      break;
+    }
+    case SsrBlockType::kPhaseBias: {
+      SatPhaseBiasPara &sv = SysOf(phase_bias_, sys_i).data[record.prn];
+      sv.prn = record.prn;
+      sv.yawdeg = record.yaw_deg;
+      sv.yawdeg_rate = record.yaw_rate;
+      for (int i = 0; i < record.num_bias; i++) {
+        int idx = SsrBiasIndex(sys_i, record.bias[i].code);
+        if (idx < 0) continue;
+        sv.bias_ele[idx].received = true;
+        sv.bias_ele[idx].value = record.bias[i].value;
+      }
+      break;
     }
+    default:
+      return;
   }
+  got_[(int)header.type][sys_i] = true;
 }
-// Request IGS data, return msg_num on success
-int BkgDataRequestor::RequestSsrData() {
-  bool recv_clk = false, recv_obt = false;
-  bool recv_cbs = false, recv_pbs = false;
-  char IGS_buf[150000] = {0};
 
-  // message received: 0 none, 1 received
-  int msg_num = 0;
-  int IGS_ret = recv(ssr_fd, IGS_buf, sizeof(IGS_buf), MSG_DONTWAIT);
-  if (IGS_ret == -1) {
-    if (!(errno == EWOULDBLOCK || errno == EAGAIN || errno == EINTR)) {
-      log_ssr << vntimefunc::GetLocalTimeString()
-              << "IGS port unexpected error: " << strerror(errno) << std::endl;
-      return -1;
-    } else {
-      return 0;
-    }
-  } else if (IGS_ret == 0) {
-    log_ssr << vntimefunc::GetLocalTimeString()
-            << "BKG has closed IGS port connection." << std::endl;
-    return -1;
-  } else if (IGS_ret > 0) {
-    // Initialize data struct for SSR
-    SatClockCorrEpoch new_clk_gps, new_clk_gal, new_clk_bds;
-    new_clk_gps.data_sv.resize(MAXPRNGPS + 1);
-    new_clk_gal.data_sv.resize(MAXPRNGAL + 1);
-    new_clk_bds.data_sv.resize(MAXPRNCMP + 1);
-    SatOrbitCorrEpoch new_obt_gps, new_obt_gal, new_obt_bds;
-    new_obt_gps.data_sv.resize(MAXPRNGPS + 1);
-    new_obt_gal.data_sv.resize(MAXPRNGAL + 1);
-    new_obt_bds.data_sv.resize(MAXPRNCMP + 1);
-    CodeBiasCorr new_cbs_gps, new_cbs_gal, new_cbs_bds;
-    new_cbs_gps.data.resize(MAXPRNGPS + 1);
-    new_cbs_gal.data.resize(MAXPRNGAL + 1);
-    new_cbs_bds.data.resize(MAXPRNCMP + 1);
-    PhaseBiasCorr new_pbs_gps, new_pbs_gal, new_pbs_bds;
-    new_pbs_gps.data.resize(MAXPRNGPS + 1);
-    new_pbs_gal.data.resize(MAXPRNGAL + 1);
-    new_pbs_bds.data.resize(MAXPRNCMP + 1);
-    std::vector<double> datetime(6, 3);
-    gtime_t ssr_time;
-    std::stringstream ssr_ss(IGS_buf), line_ss;
-    std::string line, symbol;
-    std::string type{};
-    // Check which systems in the data block
-    bool get_gps_clk = false, get_gal_clk = false, get_bds_clk = false;
-    bool get_gps_obt = false, get_gal_obt = false, get_bds_obt = false;
-    bool get_gps_cbs = false, get_gal_cbs = false, get_bds_cbs = false;
-    bool get_gps_pbs = false, get_gal_pbs = false, get_bds_pbs = false;
-    while (!ssr_ss.eof()) {
-      getline(ssr_ss, line);
-      if (line[0] == '>') {
-        ClearInputStream(line_ss, line);
-        line_ss >> symbol >> type;
-        if ((line.find(kWhuStream) != std::string::npos &&
-             (type == "CLOCK" || type == "ORBIT")) ||
-            (line.find(kCneStream) != std::string::npos &&
-             (type == "VTEC" || type == "CODE_BIAS" || type == "PHASE_BIAS"))) {
-          line_ss >> datetime[0] >> datetime[1] >> datetime[2] >> datetime[3] >>
-              datetime[4] >> datetime[5];
-          ssr_time = epoch2time(datetime);
-          // go to next line
-          continue;
+void SsrCorrectionWriter::OnVtecLayer(const SsrBlockHeader &header,
+                                      const SsrVtecLayer &layer) {
+  // Single layer model, only the first layer is used
+  if (got_vtec_) return;
+  if (layer.num_deg > kMaxVtecDegree || layer.num_ord > kMaxVtecDegree) return;
+  got_vtec_ = true;
+  vtec_.received = true;
+  vtec_.time = header.time;
+  std::copy(header.datetime, header.datetime + 6, vtec_.datetime.begin());
+  vtec_.nDeg = layer.num_deg;
+  vtec_.nOrd = layer.num_ord;
+  vtec_.height_m = layer.height_m;
+  for (int deg = 0; deg <= layer.num_deg; deg++) {
+    const double *c = layer.cos_coeffs + deg * (layer.num_ord + 1);
+    const double *s = layer.sin_coeffs + deg * (layer.num_ord + 1);
+    std::copy(c, c + layer.num_ord + 1, vtec_.cos_coeffs[deg].begin());
+    std::copy(s, s + layer.num_ord + 1, vtec_.sin_coeffs[deg].begin());
+  }
+}
+
+void SsrCorrectionWriter::OnBlockEnd(const SsrBlockHeader &header) {
+  const bool *got = got_[(int)header.type];
+  bool any = got[0] || got[1] || got[2];
+  switch (header.type) {
+    case SsrBlockType::kClock:
+    case SsrBlockType::kOrbit:
+      // The older epochs age in place
+      for (int sys_i = 0; sys_i < 3; sys_i++) {
+        if (!got[sys_i]) continue;
+        if (header.type == SsrBlockType::kClock) {
+          store_->Clock(sys_i).Publish();
         } else {
-          type = "";
-          continue;
+          store_->Orbit(sys_i).Publish();
         }
       }
-      std::string gpsdef("G"), galdef("E"), bdsdef("C");
-      // Read data
-      if (type == "CLOCK") {
-        std::string sys = line.substr(0, 1);
-        if (sys == gpsdef || sys == galdef || sys == bdsdef) {
-          recv_clk = true;
-          // ignore the first character, will be used later
-          line = line.substr(1, line.size() - 1);
-          SatClockPara new_element = ParseClockCorrElement(line);
-          if (sys == gpsdef && new_element.prn != -1) {
-            if (!get_gps_clk) {
-              new_clk_gps.datetime = datetime;
-              new_clk_gps.time = ssr_time;
-              get_gps_clk = true;
-            }
-            new_clk_gps.data_sv[new_element.prn] = new_element;
-          } else if (sys == galdef && new_element.prn != -1) {
-            if (!get_gal_clk) {
-              new_clk_gal.datetime = datetime;
-              new_clk_gal.time = ssr_time;
-              get_gal_clk = true;
-            }
-            new_clk_gal.data_sv[new_element.prn] = new_element;
-          } else if (sys == bdsdef && new_element.prn != -1) {
-            if (!get_bds_clk) {
-              new_clk_bds.datetime = datetime;
-              new_clk_bds.time = ssr_time;
-              get_bds_clk = true;
-            }
-            if (new_element.prn != -1) {
-              new_clk_bds.data_sv[new_element.prn] = new_element;
-            }
-          }
-        }
-      } else if (type == "ORBIT") {
-        std::string sys = line.substr(0, 1);
-        if (sys == gpsdef || sys == galdef || sys == bdsdef) {
-          recv_obt = true;
-          line = line.substr(1, line.size() - 1);
-          SatOrbitPara new_element = ParseOrbitCorrElement(line);
-          if (sys == gpsdef && new_element.prn != -1) {
-            if (!get_gps_obt) {
-              new_obt_gps.datetime = datetime;
-              new_obt_gps.time = ssr_time;
-              get_gps_obt = true;
-            }
-            new_obt_gps.data_sv[new_element.prn] = new_element;
-          } else if (sys == galdef && new_element.prn != -1) {
-            if (!get_gal_obt) {
-              new_obt_gal.datetime = datetime;
-              new_obt_gal.time = ssr_time;
-              get_gal_obt = true;
-            }
-            new_obt_gal.data_sv[new_element.prn] = new_element;
-          } else if (sys == bdsdef && new_element.prn != -1) {
-            if (!get_bds_obt) {
-              new_obt_bds.datetime = datetime;
-              new_obt_bds.time = ssr_time;
-              get_bds_obt = true;
-            }
-            if (new_element.prn != -1) {
-              new_obt_bds.data_sv[new_element.prn] = new_element;
-            }
-          }
-        }
-      } else if (type == "VTEC") {
-        VTecCorrection new_vtec;
-        new_vtec.received = true;
-        new_vtec.time = ssr_time;
-        new_vtec.datetime = datetime;
-        SsrVTecParser(new_vtec, ssr_ss, line);
-        msg_num = 1;
-        std::lock_guard<std::mutex> lock(tec_mutex);
-        vtec_data = new_vtec;
-        type = {};
-      } else if (type == "CODE_BIAS") {
-        std::string sys = line.substr(0, 1);
-        if (sys == gpsdef || sys == galdef || sys == bdsdef) {
-          recv_cbs = true;
-          line = line.substr(1, line.size() - 1);
-          SatCodeBiasPara new_element;
-          if (sys == gpsdef) {
-            if (!get_gps_cbs) {
-              new_cbs_gps.datetime = datetime;
-              new_cbs_gps.time = ssr_time;
-              get_gps_cbs = true;
-            }
-            ParseSsrCodeBiasCorr(new_element, line, sys);
-            if (new_element.prn != -1) {
-              new_cbs_gps.data[new_element.prn] = new_element;
-            }
-          } else if (sys == galdef) {
-            if (!get_gal_cbs) {
-              new_cbs_gal.datetime = datetime;
-              new_cbs_gal.time = ssr_time;
-              get_gal_cbs = true;
-            }
-            ParseSsrCodeBiasCorr(new_element, line, sys);
-            if (new_element.prn != -1) {
-              new_cbs_gal.data[new_element.prn] = new_element;
-            }
-          } else if (sys == bdsdef) {
-            if (!get_bds_cbs) {
-              new_cbs_bds.datetime = datetime;
-              new_cbs_bds.time = ssr_time;
-              get_bds_cbs = true;
-            }
-            ParseSsrCodeBiasCorr(new_element, line, sys);
-            if (new_element.prn != -1) {
-              new_cbs_bds.data[new_element.prn] = new_element;
-            }
+      if (any) store_->NotifyRingUpdate();
+      break;
+    case SsrBlockType::kCodeBias:
+      if (!any) return;
+      store_->Update([&](CorrectionSnapshot &corr) {
+        for (int sys_i = 0; sys_i < 3; sys_i++) {
+          if (got[sys_i]) {
+            SysOf(corr.code_bias_ssr, sys_i) = SysOf(code_bias_, sys_i);
           }
         }
-      } else if (type == "PHASE_BIAS") {
-        std::string sys = line.substr(0, 1);
-        if (sys == gpsdef || sys == galdef || sys == bdsdef) {
-          recv_pbs = true;
-          line = line.substr(1, line.size() - 1);
-          SatPhaseBiasPara new_element;
-          if (sys == gpsdef) {
-            if (!get_gps_pbs) {
-              new_pbs_gps.datetime = datetime;
-              new_pbs_gps.time = ssr_time;
-              get_gps_pbs = true;
-            }
-            ParseSsrPhaseBiasCorr(new_element, line, sys);
-            if (new_element.prn != -1 && new_element.prn <= MAXPRNGPS) {
-              new_pbs_gps.data[new_element.prn] = new_element;
-            }
-          } else if (sys == galdef) {
-            if (!get_gal_pbs) {
-              new_pbs_gal.datetime = datetime;
-              new_pbs_gal.time = ssr_time;
-              get_gal_pbs = true;
-            }
-            ParseSsrPhaseBiasCorr(new_element, line, sys);
-            if (new_element.prn != -1 && new_element.prn <= MAXPRNGAL) {
-              new_pbs_gal.data[new_element.prn] = new_element;
-            }
-          } else if (sys == bdsdef) {
-            if (!get_bds_pbs) {
-              new_pbs_bds.datetime = datetime;
-              new_pbs_bds.time = ssr_time;
-              get_bds_pbs = true;
-            }
-            ParseSsrPhaseBiasCorr(new_element, line, sys);
-            if (new_element.prn != -1 && new_element.prn <= MAXPRNCMP) {
-              new_pbs_bds.data[new_element.prn] = new_element;
-            }
+      });
+      break;
+    case SsrBlockType::kPhaseBias:
+      if (!any) return;
+      store_->Update([&](CorrectionSnapshot &corr) {
+        for (int sys_i = 0; sys_i < 3; sys_i++) {
+          if (got[sys_i]) {
+            SysOf(corr.phase_bias_ssr, sys_i) = SysOf(phase_bias_, sys_i);
           }
         }
+      });
+      break;
+    case SsrBlockType::kVtec:
+      any = got_vtec_;
+      if (!any) return;
+      store_->Update([&](CorrectionSnapshot &corr) { corr.vtec_ssr = vtec_; });
+      break;
+    default:
+      return;
+  }
+  if (any) num_published_++;
+}
+
+// Receive everything pending on fd, consume(n) is called after each recv of
+// n bytes into buf(). Returns -1 on error or closed connection.
+template <typename Buf, typename Consume>
+static int DrainSsrPort(int fd, std::ofstream &log, Buf &&buf,
+                        Consume &&consume) {
+  while (true) {
+    std::pair<char *, size_t> space = buf();
+    int IGS_ret = recv(fd, space.first, space.second, MSG_DONTWAIT);
+    if (IGS_ret == -1) {
+      if (!(errno == EWOULDBLOCK || errno == EAGAIN || errno == EINTR)) {
+        log << vntimefunc::GetLocalTimeString()
+            << "IGS port unexpected error: " << strerror(errno) << std::endl;
+        return -1;
       }
+      return 0;
+    } else if (IGS_ret == 0) {
+      log << vntimefunc::GetLocalTimeString()
+          << "BKG has closed IGS port connection." << std::endl;
+      return -1;
     }
-    // update clock data for different version
-    if (recv_clk) {
-      msg_num = 1;
-      std::lock_guard<std::mutex> lock(clk_mutex);
-      if (get_gps_clk) {
-        clk_data[2].GPS = clk_data[1].GPS;
-        clk_data[1].GPS = clk_data[0].GPS;
-        clk_data[0].GPS = new_clk_gps;
-      }
-      if (get_gal_clk) {
-        clk_data[2].GAL = clk_data[1].GAL;
-        clk_data[1].GAL = clk_data[0].GAL;
-        clk_data[0].GAL = new_clk_gal;
-      }
-      if (get_bds_clk) {
-        clk_data[2].BDS = clk_data[1].BDS;
-        clk_data[1].BDS = clk_data[0].BDS;
-        clk_data[0].BDS = new_clk_bds;
-      }
-    }
-    // update orbit data for different version
-    if (recv_obt) {
-      msg_num = 1;
-      std::lock_guard<std::mutex> lock(obt_mutex);
-      if (get_gps_obt) {
-        obt_data[2].GPS = obt_data[1].GPS;
-        obt_data[1].GPS = obt_data[0].GPS;
-        obt_data[0].GPS = new_obt_gps;
-      }
-      if (get_gal_obt) {
-        obt_data[2].GAL = obt_data[1].GAL;
-        obt_data[1].GAL = obt_data[0].GAL;
-        obt_data[0].GAL = new_obt_gal;
-      }
-      if (get_bds_obt) {
-        obt_data[2].BDS = obt_data[1].BDS;
-        obt_data[1].BDS = obt_data[0].BDS;
-        obt_data[0].BDS = new_obt_bds;
-      }
+    consume(IGS_ret);
+  }
+}
+
+BkgDataRequestor::BkgDataRequestor(std::string log_file_path,
+                                   CorrectionStore *store,
+                                   BkgSource source)
+    : store_(store),
+      file_path_(std::move(log_file_path)),
+      source_(source),
+      ssr_writer(store),
+      rtcm_decoder{RtcmSsrDecoder(kWhuStream), RtcmSsrDecoder(kCneStream)} {
+  rtcm_eph.reserve(MAXPRNGPS + MAXPRNGAL + MAXPRNCMP);
+}
+
+// Request IGS data, return msg_num on success
+int BkgDataRequestor::RequestSsrData() {
+  if (source_ == BkgSource::kRtcm3) {
+    for (int i = 0; i < 2; i++) {
+      int ret = DrainSsrPort(
+          rtcm_fd[i], log_ssr,
+          [&] { return std::make_pair((char *)rtcm_buf, sizeof(rtcm_buf)); },
+          [&](int n) {
+            if (capture_ != nullptr) {
+              capture_->Write(i == 0 ? CaptureStream::kSsrWhuRtcm
+                                     : CaptureStream::kSsrCneRtcm,
+                              rtcm_buf, n);
+            }
+            rtcm_decoder[i].Input(rtcm_buf, n, ssr_writer);
+          });
+      if (ret == -1) return -1;
     }
-    // update code bias data
-    if (recv_cbs) {
-      msg_num = 1;
-      std::lock_guard<std::mutex> lock(cbs_mutex);
-      if (get_gps_cbs) {
-        code_bias.GPS = new_cbs_gps;
-      }
-      if (get_gal_cbs) {
-        code_bias.GAL = new_cbs_gal;
-      }
-      if (get_bds_cbs) {
-        code_bias.BDS = new_cbs_bds;
-      }
+  } else {
+    // Records split between two recv are kept by the parser until completed
+    int ret = DrainSsrPort(
+        ssr_fd, log_ssr,
+        [&] {
+          return std::make_pair(ssr_parser.WritePtr(), ssr_parser.WriteSpace());
+        },
+        [&](int n) {
+          if (capture_ != nullptr) {
+            capture_->Write(CaptureStream::kSsrText, ssr_parser.WritePtr(), n);
+          }
+          ssr_parser.Commit(n);
+          ssr_parser.Parse(ssr_writer);
+        });
+    if (ret == -1) return -1;
+  }
+  // message received: 0 none, 1 received
+  int msg_num = ssr_writer.TakeNumPublished() > 0 ? 1 : 0;
+  return msg_num;
+}
+
+// Feed a chunk received on stream, e.g. from a capture file. Returns the
+// no. of updated sv for the ephemeris streams and 1 when SSR corrections
+// were published for the SSR streams.
+int BkgDataRequestor::InputStream(CaptureStream stream, const char *data,
+                                  size_t n) {
+  switch (stream) {
+    case CaptureStream::kEphText:
+      return DecodeEphText(data, n);
+    case CaptureStream::kEphRtcm: {
+      std::lock_guard<std::mutex> lock(eph_write_mutex);
+      return DecodeRtcmEph((const uint8_t *)data, n);
     }
-    // update phase bias data
-    if (recv_pbs) {
-      msg_num = 1;
-      std::lock_guard<std::mutex> lock(pbs_mutex);
-      if (get_gps_pbs) {
-        phase_bias.GPS = new_pbs_gps;
-      }
-      if (get_gal_pbs) {
-        phase_bias.GAL = new_pbs_gal;
-      }
-      if (get_bds_pbs) {
-        phase_bias.BDS = new_pbs_bds;
+    case CaptureStream::kSsrText:
+      while (n > 0) {
+        size_t len = std::min(n, ssr_parser.WriteSpace());
+        memcpy(ssr_parser.WritePtr(), data, len);
+        ssr_parser.Commit(len);
+        ssr_parser.Parse(ssr_writer);
+        data += len;
+        n -= len;
       }
+      break;
+    case CaptureStream::kSsrWhuRtcm:
+    case CaptureStream::kSsrCneRtcm:
+      rtcm_decoder[stream == CaptureStream::kSsrWhuRtcm ? 0 : 1].Input(
+          (const uint8_t *)data, n, ssr_writer);
+      break;
+  }
+  return ssr_writer.TakeNumPublished() > 0 ? 1 : 0;
+}
+
+// Connect the SSR port(s) of the configured source
+bool BkgDataRequestor::ConnectSsrPorts() {
+  if (source_ == BkgSource::kRtcm3) {
+    return BkgSocketClient(kWhuRtcmPort, kLocalIp, rtcm_fd[0]) &&
+           BkgSocketClient(kCneRtcmPort, kLocalIp, rtcm_fd[1]);
+  }
+  return BkgSocketClient(kSsrPort, kLocalIp, ssr_fd);
+}
+
+void BkgDataRequestor::CloseSsrPorts() {
+  if (source_ == BkgSource::kRtcm3) {
+    for (int &fd : rtcm_fd) {
+      if (fd != -1) close(fd);
+      fd = -1;
     }
+  } else {
+    close(ssr_fd);
   }
-  return msg_num;
 }
 
 void BkgDataRequestor::GpsEphParser(std::stringstream &eph_ss,
@@ -616,12 +541,10 @@ void BkgDataRequestor::BdsEphParser(std::stringstream &eph_ss,
   eph_element.IODC = static_cast<size_t>(AODC);
 }
 
-// Request ephemeris data, return true on success
-// return - 1 for error, 0 for no sv update, >0 for no. of updated sv
-int BkgDataRequestor::RequestEphData() {
-  char eph_buf[100000] = {0};
-  int num_sv = 0;
-  int eph_ret = recv(eph_fd, eph_buf, sizeof(eph_buf), MSG_DONTWAIT);
+// Receive pending ephemeris data, return the number of bytes, -1 for error
+// and -2 for no data
+int BkgDataRequestor::ReceiveEph(char *buf, size_t size) {
+  int eph_ret = recv(eph_fd, buf, size, MSG_DONTWAIT);
   if (eph_ret == -1) {
     if (!(errno == EWOULDBLOCK || errno == EAGAIN || errno == EINTR)) {
       log_eph << vntimefunc::GetLocalTimeString()
@@ -634,99 +557,132 @@ int BkgDataRequestor::RequestEphData() {
     log_eph << vntimefunc::GetLocalTimeString()
             << "BKG has closed EPH port connection." << std::endl;
     return -1;
-  } else if (eph_ret > 0) {
-    std::stringstream eph_ss(eph_buf), ss;
-    std::string line, type{}, sv_rcrd{};
-    while (!eph_ss.eof()) {
-      getline(eph_ss, line);
-      if (line[0] == 'G' || line[0] == 'E' || line[0] == 'C') {
-        // read line 1
-        satstruct::Ephemeris eph_element{};
-        ClearInputStream(ss, line);
-        char system;
-        double teph[6];
-        ss >> system >> eph_element.prn >> teph[0] >> teph[1] >> teph[2] >>
-            teph[3] >> teph[4] >> teph[5] >> eph_element.a_f0 >>
-            eph_element.a_f1 >> eph_element.a_f2;
-        if (teph[0] < 2000) teph[0] += 2000;
-        eph_element.t_oc = epoch2time(teph);
-        int check = 0;  // If this eph data exist, :while" continue
-        int log_iod_new, log_iod_old;
-        if (line[0] == 'G') {
-          GpsEphParser(eph_ss, eph_element, eph_element.t_oc);
-          log_iod_new = eph_element.IODE;
-          log_iod_old = eph_data[0].GPS_eph[eph_element.prn].IODE;
-          for (auto &i : eph_data) {
-            if (eph_element.IODE == i.GPS_eph[eph_element.prn].IODE &&
-                i.GPS_eph[eph_element.prn].prn != -1) {
-              check = 1;
-              continue;
-            }
-          }
-        } else if (line[0] == 'E') {
-          GalEphParser(eph_ss, eph_element, eph_element.t_oc);
-          // only reserve I/NAV massage (Date source: 517 for I/NAV, 258 for
-          // F/NAV)
-          if (eph_element.data_src != 517) {
-            check = 1;
-          }
-          log_iod_new = eph_element.IODE;
-          log_iod_old = eph_data[0].GAL_eph[eph_element.prn].IODE;
-          for (auto &i : eph_data) {
-            if (eph_element.IODE == i.GAL_eph[eph_element.prn].IODE &&
-                i.GAL_eph[eph_element.prn].prn != -1) {
-              check = 1;
-              continue;
-            }
-          }
-        } else if (line[0] == 'C') {
-          eph_element.t_oc = bdt2gpst(eph_element.t_oc);
-          BdsEphParser(eph_ss, eph_element, eph_element.t_oc);
-          log_iod_new = eph_element.IODE;
-          log_iod_old = eph_data[0].BDS_eph[eph_element.prn].IODE;
-          for (auto &i : eph_data) {
-            if (eph_element.IODE == i.BDS_eph[eph_element.prn].IODE &&
-                i.BDS_eph[eph_element.prn].prn != -1) {
-              check = 1;
-              continue;
-            }
-          }
-        }
-        if (check == 0) {  // When check = 1, nothing update
-          num_sv++;
-          log_eph << line[0] << eph_element.prn << " IODE " << log_iod_old
-                  << " updated to " << log_iod_new << std::endl;
-          sv_rcrd.append(line[0] + std::to_string(eph_element.prn) + " ");
-          if (line[0] == 'G') {
-            std::lock_guard<std::mutex> lock(eph_mutex);
-            for (int ver = VN_MAX_NUM_OF_EPH_EPOCH - 1; ver > 0; ver--) {
-              eph_data[ver].GPS_eph[eph_element.prn] =
-                  eph_data[ver - 1].GPS_eph[eph_element.prn];
-            }
-            eph_data[0].GPS_eph[eph_element.prn] = eph_element;
-          } else if (line[0] == 'E') {
-            std::lock_guard<std::mutex> lock(eph_mutex);
-            for (int ver = VN_MAX_NUM_OF_EPH_EPOCH - 1; ver > 0; ver--) {
-              eph_data[ver].GAL_eph[eph_element.prn] =
-                  eph_data[ver - 1].GAL_eph[eph_element.prn];
-            }
-            eph_data[0].GAL_eph[eph_element.prn] = eph_element;
-          } else if (line[0] == 'C') {
-            std::lock_guard<std::mutex> lock(eph_mutex);
-            for (int ver = VN_MAX_NUM_OF_EPH_EPOCH - 1; ver > 0; ver--) {
-              eph_data[ver].BDS_eph[eph_element.prn] =
-                  eph_data[ver - 1].BDS_eph[eph_element.prn];
-            }
-            eph_data[0].BDS_eph[eph_element.prn] = eph_element;
-          }
-        }
-      }
+  }
+  return eph_ret;
+}
+
+// Request ephemeris data, return true on success
+// return - 1 for error, 0 for no sv update, >0 for no. of updated sv
+int BkgDataRequestor::RequestEphData() {
+  if (source_ == BkgSource::kRtcm3) {
+    return RequestRtcmEphData();
+  }
+  char eph_buf[100000] = {0};
+  int eph_ret = ReceiveEph(eph_buf, sizeof(eph_buf) - 1);
+  if (eph_ret < 0) {
+    return eph_ret;
+  }
+  if (capture_ != nullptr) {
+    capture_->Write(CaptureStream::kEphText, eph_buf, eph_ret);
+  }
+  return DecodeEphText(eph_buf, eph_ret);
+}
+
+// Parse and publish a chunk of the BNC text ephemeris, return the no. of
+// updated sv
+int BkgDataRequestor::DecodeEphText(const char *buf, size_t n) {
+  std::stringstream eph_ss(std::string(buf, n)), ss;
+  std::string line, type{};
+  // Parsed ephemeris with their system letter
+  std::vector<std::pair<char, satstruct::Ephemeris>> new_eph;
+  while (!eph_ss.eof()) {
+    getline(eph_ss, line);
+    if (line[0] == 'G' || line[0] == 'E' || line[0] == 'C') {
+      // read line 1
+      satstruct::Ephemeris eph_element{};
+      ClearInputStream(ss, line);
+      char system;
+      double teph[6];
+      ss >> system >> eph_element.prn >> teph[0] >> teph[1] >> teph[2] >>
+          teph[3] >> teph[4] >> teph[5] >> eph_element.a_f0 >>
+          eph_element.a_f1 >> eph_element.a_f2;
+      if (teph[0] < 2000) teph[0] += 2000;
+      eph_element.t_oc = epoch2time(teph);
+      if (line[0] == 'G') {
+        GpsEphParser(eph_ss, eph_element, eph_element.t_oc);
+      } else if (line[0] == 'E') {
+        GalEphParser(eph_ss, eph_element, eph_element.t_oc);
+      } else if (line[0] == 'C') {
+        eph_element.t_oc = bdt2gpst(eph_element.t_oc);
+        BdsEphParser(eph_ss, eph_element, eph_element.t_oc);
+      }
+      new_eph.emplace_back(line[0], eph_element);
     }
-    if (num_sv > 0) {
-      log_eph << vntimefunc::GetLocalTimeString() << "recv sv prn: " << sv_rcrd
-              << "data" << std::endl;
+  }
+  if (new_eph.empty()) {
+    return 0;
+  }
+  // RequestEphData also runs on the SSR thread, serialize the writers
+  std::lock_guard<std::mutex> lock(eph_write_mutex);
+  return PublishEph(new_eph);
+}
+
+// Ephemeris from the raw RTCM 3 stream, same return as RequestEphData
+int BkgDataRequestor::RequestRtcmEphData() {
+  // RequestEphData also runs on the SSR thread, one reader of the decoder
+  std::lock_guard<std::mutex> lock(eph_write_mutex);
+  int eph_ret = ReceiveEph((char *)rtcm_eph_buf, sizeof(rtcm_eph_buf));
+  if (eph_ret < 0) {
+    return eph_ret;
+  }
+  if (capture_ != nullptr) {
+    capture_->Write(CaptureStream::kEphRtcm, rtcm_eph_buf, eph_ret);
+  }
+  return DecodeRtcmEph(rtcm_eph_buf, eph_ret);
+}
+
+// Decode and publish a chunk of the RTCM 3 ephemeris stream,
+// eph_write_mutex must be held. Return the no. of updated sv.
+int BkgDataRequestor::DecodeRtcmEph(const uint8_t *buf, size_t n) {
+  rtcm_eph.clear();
+  eph_decoder.Input(buf, n, [&](char sys, const satstruct::Ephemeris &eph) {
+    rtcm_eph.emplace_back(sys, eph);
+  });
+  return PublishEph(rtcm_eph);
+}
+
+// Publish the new ephemeris to the rings, eph_write_mutex must be held.
+// Return the no. of updated sv.
+int BkgDataRequestor::PublishEph(
+    const std::vector<std::pair<char, satstruct::Ephemeris>> &new_eph) {
+  auto sys_index = [](char sys) {
+    if (sys == 'G') return 0;
+    if (sys == 'E') return 1;
+    return 2;
+  };
+  int num_sv = 0;
+  std::string sv_rcrd{};
+  for (auto &elem : new_eph) {
+    char sys = elem.first;
+    const satstruct::Ephemeris &eph_element = elem.second;
+    // only reserve I/NAV massage (Date source: 517 for I/NAV, 258 for
+    // F/NAV)
+    if (sys == 'E' && eph_element.data_src != 517) {
+      continue;
+    }
+    const int max_prn[3] = {MAXPRNGPS, MAXPRNGAL, MAXPRNCMP};
+    if (eph_element.prn < 1 || eph_element.prn > max_prn[sys_index(sys)]) {
+      continue;
     }
-    return num_sv;
+    SatEphStore &sat_eph = store_->Eph(sys_index(sys), eph_element.prn);
+    // Check if this eph data exist
+    if (sat_eph.HasIod((int)eph_element.IODE)) {
+      continue;  // nothing update
+    }
+    num_sv++;
+    const satstruct::Ephemeris *latest = sat_eph.Latest();
+    log_eph << sys << eph_element.prn << " IODE "
+            << (latest ? latest->IODE : satstruct::Ephemeris().IODE)
+            << " updated to " << eph_element.IODE << std::endl;
+    sv_rcrd.append(sys + std::to_string(eph_element.prn) + " ");
+    sat_eph.Publish(eph_element);
+  }
+  if (num_sv > 0) {
+    store_->NotifyRingUpdate();
+  }
+  if (num_sv > 0) {
+    log_eph << vntimefunc::GetLocalTimeString() << "recv sv prn: " << sv_rcrd
+            << "data" << std::endl;
   }
   return num_sv;
 }
@@ -759,107 +715,55 @@ bool BkgDataRequestor::BkgSocketClient(int port, const char *ip, int &fd) {
 
 // Output IGS data to log file
 void BkgDataRequestor::WriteSsrToLog() {
+  // Called by the SSR thread, which is the only writer of the SSR rings
+  const char *sys_name[3] = {"GPS: ", "GAL: ", "BDS: "};
+  const char *sys_code[3] = {"G-", "E-", "C-"};
   log_ssr << vntimefunc::GetLocalTimeString() << "Current clock data" << '\n';
-  SatClockCorrEpoch clk_gps = clk_data[0].GPS;
-  log_ssr << "GPS: " << clk_gps.datetime[0] << "-" << clk_gps.datetime[1] << "-"
-          << clk_gps.datetime[2] << " " << clk_gps.datetime[3] << ":"
-          << clk_gps.datetime[4] << ":" << clk_gps.datetime[5] << '\n';
-  for (int i = 1; i < MAXPRNGPS + 1; i++) {
-    if (clk_gps.data_sv[i].prn != -1) {
-      log_ssr << "G-" << clk_gps.data_sv[i].prn
-              << " IOD: " << clk_gps.data_sv[i].IOD;
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << clk_gps.data_sv[i].dt_corr_s[k];
-      }
-      log_ssr << '\n';
-    }
-  }
-  SatClockCorrEpoch clk_gal = clk_data[0].GAL;
-  log_ssr << "GAL: " << clk_gal.datetime[0] << "-" << clk_gal.datetime[1] << "-"
-          << clk_gal.datetime[2] << " " << clk_gal.datetime[3] << ":"
-          << clk_gal.datetime[4] << ":" << clk_gal.datetime[5] << '\n';
-  for (int i = 1; i < MAXPRNGAL + 1; i++) {
-    if (clk_gal.data_sv[i].prn != -1) {
-      log_ssr << "E-" << clk_gal.data_sv[i].prn
-              << " IOD: " << clk_gal.data_sv[i].IOD;
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << clk_gal.data_sv[i].dt_corr_s[k];
-      }
-      log_ssr << '\n';
-    }
-  }
-  SatClockCorrEpoch clk_bds = clk_data[0].BDS;
-  log_ssr << "BDS: " << clk_bds.datetime[0] << "-" << clk_bds.datetime[1] << "-"
-          << clk_bds.datetime[2] << " " << clk_bds.datetime[3] << ":"
-          << clk_bds.datetime[4] << ":" << clk_bds.datetime[5] << '\n';
-  for (int i = 1; i < MAXPRNCMP + 1; i++) {
-    if (clk_bds.data_sv[i].prn != -1) {
-      log_ssr << "C-" << clk_bds.data_sv[i].prn
-              << " IOD: " << clk_bds.data_sv[i].IOD;
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << clk_bds.data_sv[i].dt_corr_s[k];
+  for (int sys_i = 0; sys_i < 3; sys_i++) {
+    const SatClockCorrEpoch *clk = store_->Clock(sys_i).Latest();
+    if (clk == nullptr) continue;
+    log_ssr << sys_name[sys_i] << clk->datetime[0] << "-" << clk->datetime[1]
+            << "-" << clk->datetime[2] << " " << clk->datetime[3] << ":"
+            << clk->datetime[4] << ":" << clk->datetime[5] << '\n';
+    for (size_t i = 1; i < clk->data_sv.size(); i++) {
+      const SatClockPara &sv = clk->data_sv[i];
+      if (sv.prn != -1) {
+        log_ssr << sys_code[sys_i] << sv.prn << " IOD: " << sv.IOD;
+        for (int k = 0; k < 3; k++) {
+          log_ssr << " " << sv.dt_corr_s[k];
+        }
+        log_ssr << '\n';
       }
-      log_ssr << '\n';
     }
   }
 
   log_ssr << vntimefunc::GetLocalTimeString() << "Current orbit data" << '\n';
-  SatOrbitCorrEpoch obt_gps = obt_data[0].GPS;
-  log_ssr << "GPS: " << obt_gps.datetime[0] << "-" << obt_gps.datetime[1] << "-"
-          << obt_gps.datetime[2] << " " << obt_gps.datetime[3] << ":"
-          << obt_gps.datetime[4] << ":" << obt_gps.datetime[5] << '\n';
-  for (int i = 1; i < MAXPRNGPS + 1; i++) {
-    if (obt_gps.data_sv[i].prn != -1) {
-      log_ssr << "G-" << obt_gps.data_sv[i].prn
-              << " IOD: " << obt_gps.data_sv[i].IOD;
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << obt_gps.data_sv[i].dx_m[k];
-      }
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << obt_gps.data_sv[i].dv_m[k];
-      }
-      log_ssr << '\n';
-    }
-  }
-  SatOrbitCorrEpoch obt_gal = obt_data[0].GAL;
-  log_ssr << "GAL: " << obt_gal.datetime[0] << "-" << obt_gal.datetime[1] << "-"
-          << obt_gal.datetime[2] << " " << obt_gal.datetime[3] << ":"
-          << obt_gal.datetime[4] << ":" << obt_gal.datetime[5] << '\n';
-  for (int i = 1; i < MAXPRNGAL + 1; i++) {
-    if (obt_gal.data_sv[i].prn != -1) {
-      log_ssr << "E-" << obt_gal.data_sv[i].prn
-              << " IOD: " << obt_gal.data_sv[i].IOD;
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << obt_gal.data_sv[i].dx_m[k];
-      }
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << obt_gal.data_sv[i].dv_m[k];
-      }
-      log_ssr << '\n';
-    }
-  }
-  SatOrbitCorrEpoch obt_bds = obt_data[0].BDS;
-  log_ssr << "BDS: " << obt_bds.datetime[0] << "-" << obt_bds.datetime[1] << "-"
-          << obt_bds.datetime[2] << " " << obt_bds.datetime[3] << ":"
-          << obt_bds.datetime[4] << ":" << obt_bds.datetime[5] << '\n';
-  for (int i = 1; i < MAXPRNCMP + 1; i++) {
-    if (obt_bds.data_sv[i].prn != -1) {
-      log_ssr << "C-" << obt_bds.data_sv[i].prn
-              << " IOD: " << obt_bds.data_sv[i].IOD;
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << obt_bds.data_sv[i].dx_m[k];
-      }
-      for (int k = 0; k < 3; k++) {
-        log_ssr << " " << obt_bds.data_sv[i].dv_m[k];
+  for (int sys_i = 0; sys_i < 3; sys_i++) {
+    const SatOrbitCorrEpoch *obt = store_->Orbit(sys_i).Latest();
+    if (obt == nullptr) continue;
+    log_ssr << sys_name[sys_i] << obt->datetime[0] << "-" << obt->datetime[1]
+            << "-" << obt->datetime[2] << " " << obt->datetime[3] << ":"
+            << obt->datetime[4] << ":" << obt->datetime[5] << '\n';
+    for (size_t i = 1; i < obt->data_sv.size(); i++) {
+      const SatOrbitPara &sv = obt->data_sv[i];
+      if (sv.prn != -1) {
+        log_ssr << sys_code[sys_i] << sv.prn << " IOD: " << sv.IOD;
+        for (int k = 0; k < 3; k++) {
+          log_ssr << " " << sv.dx_m[k];
+        }
+        for (int k = 0; k < 3; k++) {
+          log_ssr << " " << sv.dv_m[k];
+        }
+        log_ssr << '\n';
       }
-      log_ssr << '\n';
     }
   }
   log_ssr << std::endl;
 }
 
 void BkgDataRequestor::RequestEph() {
-  if (!BkgSocketClient(kEphPort, kLocalIp, eph_fd)) {
+  int eph_port = source_ == BkgSource::kRtcm3 ? kEphRtcmPort : kEphPort;
+  if (!BkgSocketClient(eph_port, kLocalIp, eph_fd)) {
     std::cerr << "Please received if the eph data port enable" << std::endl;
     pthread_exit(nullptr);
   }
@@ -919,7 +823,7 @@ void BkgDataRequestor::RequestEph() {
 }
 
 void BkgDataRequestor::RequestSsr() {
-  if (!BkgSocketClient(kSsrPort, kLocalIp, ssr_fd)) {
+  if (!ConnectSsrPorts()) {
     std::cerr << "Please received if the igs correction port enable"
               << std::endl;
     pthread_exit(nullptr);
@@ -928,7 +832,7 @@ void BkgDataRequestor::RequestSsr() {
   while (true) {
     int IGS_check = RequestSsrData();
     if (IGS_check == -1) {
-      close(ssr_fd);
+      CloseSsrPorts();
       pthread_exit(nullptr);
     } else if (IGS_check > 0) {
       break;
@@ -971,14 +875,14 @@ void BkgDataRequestor::RequestSsr() {
       file_t = now;
     }
     if (RequestSsrData() == -1) {
-      close(ssr_fd);
+      CloseSsrPorts();
       pthread_exit(nullptr);
     }
     // Keep read port untill no data update
     while (true) {
       int eph_check = RequestEphData();
       if (eph_check == -1) {
-        close(ssr_fd);
+        CloseSsrPorts();
         pthread_exit(nullptr);
       } else if (eph_check == 0) {
         break;
@@ -999,36 +903,6 @@ void *BkgDataRequestor::RequestSsrWrapper(void *arg) {
   return nullptr;
 }
 
-std::vector<SsrOrbitCorrEpoch> BkgDataRequestor::GetSatOrbitCorrEpochs() {
-  std::lock_guard<std::mutex> lock(obt_mutex);
-  return obt_data;
-}
-
-std::vector<SsrClockCorrEpoch> BkgDataRequestor::GetSatClockCorrEpochs() {
-  std::lock_guard<std::mutex> lock(clk_mutex);
-  return clk_data;
-}
-
-std::vector<GnssEphStruct> BkgDataRequestor::GetGnssEphDataEpochs() {
-  std::lock_guard<std::mutex> lock(eph_mutex);
-  return eph_data;
-}
-
-VTecCorrection BkgDataRequestor::GetSsrVTecCorr() {
-  std::lock_guard<std::mutex> lock(tec_mutex);
-  return vtec_data;
-}
-
-SsrCodeBiasEpoch BkgDataRequestor::GetSsrCodeBiasCorr() {
-  std::lock_guard<std::mutex> lock(cbs_mutex);
-  return code_bias;
-}
-
-SsrPhaseBiasEpoch BkgDataRequestor::GetSsrPhaseBiasCorr() {
-  std::lock_guard<std::mutex> lock(pbs_mutex);
-  return phase_bias;
-}
-
 // start data request
 void BkgDataRequestor::StartRequestor() {
   eph_done = false;
@@ -1044,10 +918,6 @@ void BkgDataRequestor::StartRequestor() {
   if (!(log_eph.is_open() && log_ssr.is_open())) {
     fprintf(stderr, "BKG requestor log file cannot be opened\n");
   }
-  // Resize eph_data to 10 versions
-  eph_data.resize(VN_MAX_NUM_OF_EPH_EPOCH);
-  clk_data.resize(3);
-  obt_data.resize(3);
   pthread_create(&pid_eph, nullptr, RequestEphWrapper, this);
   pthread_create(&pid_ssr, nullptr, RequestSsrWrapper, this);
   while (!(eph_ready && ssr_ready)) {
@@ -4,133 +4,99 @@
 #pragma once
 #include <arpa/inet.h>
 
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
 #include "constants.h"
 #include "data_struct.h"
+#include "rtcm_eph_decoder.h"
+#include "rtcm_ssr_decoder.h"
+#include "ssr_text_parser.h"
+#include "stream_capture.h"
 #include "time_common_func.h"
 
-struct GnssEphStruct {
-  std::vector<satstruct::Ephemeris> GPS_eph;
-  std::vector<satstruct::Ephemeris> GAL_eph;
-  std::vector<satstruct::Ephemeris> BDS_eph;
-  GnssEphStruct() {
-    GPS_eph.resize(MAXPRNGPS + 1);
-    GAL_eph.resize(MAXPRNGAL + 1);
-    BDS_eph.resize(MAXPRNCMP + 1);
-  }
-};
+// Capacity of the per-satellite arrays of the SSR corrections, indexed by
+// PRN for GPS, GAL and BDS alike
+static constexpr int kMaxSsrPrn = std::max({MAXPRNGPS, MAXPRNGAL, MAXPRNCMP});
+// Capacity of the VTEC spherical harmonic coefficients per degree/order
+static constexpr int kMaxVtecDegree = SsrVtecLayer::kMaxDegree;
+
+// The SSR corrections below are fixed-size and trivially copyable, so a
+// ring slot or a snapshot is copied without any allocation.
 
 // Satellite orbit correction parameters for a satellite.
 struct SatOrbitPara {
-  int prn;
+  int prn{-1};
   int IOD{};
   // unit: meter
-  std::vector<double> dx_m;
-  std::vector<double> dv_m;
-  SatOrbitPara() {
-    prn = -1;
-    dx_m.resize(3);
-    dv_m.resize(3);
-  }
+  std::array<double, 3> dx_m{};
+  std::array<double, 3> dv_m{};
 };
 
 // Satellite orbit correction for one epoch
 struct SatOrbitCorrEpoch {
-  std::vector<double> datetime;
+  std::array<double, 6> datetime{};
   gtime_t time{};
-  std::vector<SatOrbitPara> data_sv;
-  SatOrbitCorrEpoch() { datetime.resize(6); }
+  std::array<SatOrbitPara, kMaxSsrPrn + 1> data_sv{};
 };
 
 // Satellite clock correction parameters for a satellite.
 struct SatClockPara {
-  int prn;
+  int prn{-1};
   int IOD{};
   // unit: sec
-  std::vector<double> dt_corr_s;
-  SatClockPara() {
-    prn = -1;
-    dt_corr_s.resize(3);
-  }
+  std::array<double, 3> dt_corr_s{};
 };
 
 // Satellite clock correction for one epoch
 struct SatClockCorrEpoch {
-  std::vector<double> datetime;
+  std::array<double, 6> datetime{};
   gtime_t time{};
-  std::vector<SatClockPara> data_sv;
-  SatClockCorrEpoch() { datetime.resize(6); }
-};
-
-// Multi-GNSS SSR orbit correction for one epoch
-struct SsrOrbitCorrEpoch {
-  SatOrbitCorrEpoch GPS;
-  SatOrbitCorrEpoch GAL;
-  SatOrbitCorrEpoch BDS;
-  SsrOrbitCorrEpoch() {
-    GPS.data_sv.resize(MAXPRNGPS + 1);
-    GAL.data_sv.resize(MAXPRNGAL + 1);
-    BDS.data_sv.resize(MAXPRNCMP + 1);
-  }
-};
-
-// Multi-GNSS SSR orbit correction for one epoch
-struct SsrClockCorrEpoch {
-  SatClockCorrEpoch GPS;
-  SatClockCorrEpoch GAL;
-  SatClockCorrEpoch BDS;
-  SsrClockCorrEpoch() {
-    GPS.data_sv.resize(MAXPRNGPS + 1);
-    GAL.data_sv.resize(MAXPRNGAL + 1);
-    BDS.data_sv.resize(MAXPRNCMP + 1);
-  }
+  std::array<SatClockPara, kMaxSsrPrn + 1> data_sv{};
 };
 
 // Vertical Total Electron Content (VTEC) in ionosphere
 struct VTecCorrection {
   //  True when received SSR VTEC
-  bool received;
+  bool received{false};
 
   gtime_t time{};
-  std::vector<double> datetime;
+  std::array<double, 6> datetime{};
   int nDeg{}, nOrd{};
 
   // meter
   double height_m{};
-  std::vector<std::vector<double>> sin_coeffs;
-  std::vector<std::vector<double>> cos_coeffs;
-  VTecCorrection() { received = false; }
+  // [degree][order], valid up to nDeg/nOrd
+  std::array<std::array<double, kMaxVtecDegree + 1>, kMaxVtecDegree + 1>
+      sin_coeffs{};
+  std::array<std::array<double, kMaxVtecDegree + 1>, kMaxVtecDegree + 1>
+      cos_coeffs{};
 };
 
 // SSR satellite hardware (code/phase) bias element
 struct BiasElement {
   // when not available, this value is false
-  bool received;
+  bool received{false};
 
-  double value;
-  BiasElement() {
-    received = false;
-    value = 0.0;
-  }
+  double value{0.0};
 };
 
 // Satellite phase bias correction parameters
 struct SatPhaseBiasPara {
-  int prn;
+  int prn{-1};
   double yawdeg{};
   double yawdeg_rate{};
-  std::vector<BiasElement> bias_ele;
-  SatPhaseBiasPara() {
-    prn = -1;
-    bias_ele.resize(MAX_CODE_ELEMENTS);
-  }
+  std::array<BiasElement, MAX_CODE_ELEMENTS> bias_ele{};
 };
 
 // satellite phase bias correction
 struct PhaseBiasCorr {
-  std::vector<double> datetime;
+  std::array<double, 6> datetime{};
   gtime_t time{};
-  std::vector<SatPhaseBiasPara> data;
-  PhaseBiasCorr() { datetime.resize(6); }
+  std::array<SatPhaseBiasPara, kMaxSsrPrn + 1> data{};
 };
 
 // Multi-GNSS satellite phase bias correction
@@ -138,29 +104,19 @@ struct SsrPhaseBiasEpoch {
   PhaseBiasCorr GPS;
   PhaseBiasCorr BDS;
   PhaseBiasCorr GAL;
-  SsrPhaseBiasEpoch() {
-    GPS.data.resize(MAXPRNGPS + 1);
-    GAL.data.resize(MAXPRNGAL + 1);
-    BDS.data.resize(MAXPRNCMP + 1);
-  }
 };
 
 // Satellite code bias correction parameters
 struct SatCodeBiasPara {
-  int prn;
-  std::vector<BiasElement> bias_ele;
-  SatCodeBiasPara() {
-    prn = -1;
-    bias_ele.resize(MAX_CODE_ELEMENTS);
-  }
+  int prn{-1};
+  std::array<BiasElement, MAX_CODE_ELEMENTS> bias_ele{};
 };
 
 // satellite code bias correction
 struct CodeBiasCorr {
-  std::vector<double> datetime;
+  std::array<double, 6> datetime{};
   gtime_t time{};
-  std::vector<SatCodeBiasPara> data;
-  CodeBiasCorr() { datetime.resize(6); }
+  std::array<SatCodeBiasPara, kMaxSsrPrn + 1> data{};
 };
 
 // Multi-GNSS satellite code bias correction
@@ -168,21 +124,63 @@ struct SsrCodeBiasEpoch {
   CodeBiasCorr GPS;
   CodeBiasCorr BDS;
   CodeBiasCorr GAL;
-  SsrCodeBiasEpoch() {
-    GPS.data.resize(MAXPRNGPS + 1);
-    GAL.data.resize(MAXPRNGAL + 1);
-    BDS.data.resize(MAXPRNCMP + 1);
+};
+
+static_assert(std::is_trivially_copyable<SatOrbitCorrEpoch>::value &&
+                  std::is_trivially_copyable<SatClockCorrEpoch>::value &&
+                  std::is_trivially_copyable<VTecCorrection>::value &&
+                  std::is_trivially_copyable<SsrPhaseBiasEpoch>::value &&
+                  std::is_trivially_copyable<SsrCodeBiasEpoch>::value,
+              "SSR corrections must be trivially copyable");
+
+class CorrectionStore;
+
+// Writes the SSR blocks parsed from the BNC stream to the CorrectionStore:
+// orbit/clock into the next slot of the rings, biases and VTEC into a
+// snapshot update. Each block is published when complete.
+class SsrCorrectionWriter : public SsrTextParser::Handler {
+ public:
+  explicit SsrCorrectionWriter(CorrectionStore *store);
+  bool OnBlockBegin(const SsrBlockHeader &header) override;
+  void OnSatRecord(const SsrBlockHeader &header,
+                   const SsrSatRecord &record) override;
+  void OnVtecLayer(const SsrBlockHeader &header,
+                   const SsrVtecLayer &layer) override;
+  void OnBlockEnd(const SsrBlockHeader &header) override;
+  // Blocks published since the last call
+  int TakeNumPublished() { return std::exchange(num_published_, 0); }
+
+ private:
+  CorrectionStore *store_;
+  static constexpr int kNumBlockTypes = (int)SsrBlockType::kVtec + 1;
+  // Systems (0 GPS, 1 GAL, 2 BDS) with records in the open block of each
+  // type, orbit and clock blocks of a combined message are open together
+  bool got_[kNumBlockTypes][3]{};
+  bool got_vtec_{};
+  int num_published_{};
+  // Biases and VTEC of the open blocks
+  SsrCodeBiasEpoch code_bias_;
+  SsrPhaseBiasEpoch phase_bias_;
+  VTecCorrection vtec_;
+
+  template <typename T>
+  static auto &SysOf(T &epoch, int sys_i) {
+    return sys_i == 0 ? epoch.GPS : (sys_i == 1 ? epoch.GAL : epoch.BDS);
   }
 };
 
+// Where the ephemeris and SSR corrections come from
+enum class BkgSource {
+  // BNC decodes the streams and outputs text on its EPH and correction ports
+  kBncText,
+  // Raw RTCM 3 streams decoded here, one port per stream
+  kRtcm3
+};
+
 class BkgDataRequestor {
  private:
-  std::mutex clk_mutex;
-  std::mutex obt_mutex;
-  std::mutex eph_mutex;
-  std::mutex tec_mutex;
-  std::mutex cbs_mutex;
-  std::mutex pbs_mutex;
+  // Corrections are published here, see correction_snapshot.h
+  CorrectionStore *store_;
 
   // Log for eph data record
   std::ofstream log_eph;
@@ -191,20 +189,41 @@ class BkgDataRequestor {
   std::ofstream log_ssr;
   const std::string file_path_;
 
+  const BkgSource source_;
+  // BNC SSR stream, parsed incrementally into the store
+  SsrTextParser ssr_parser;
+  SsrCorrectionWriter ssr_writer;
+  // Raw RTCM 3 streams: orbit/clock (WHU) and biases/VTEC (CNE)
+  RtcmSsrDecoder rtcm_decoder[2];
+  int rtcm_fd[2]{-1, -1};
+  uint8_t rtcm_buf[8192]{};
+  // Raw RTCM 3 ephemeris stream
+  RtcmEphDecoder eph_decoder;
+  uint8_t rtcm_eph_buf[8192]{};
+  std::vector<std::pair<char, satstruct::Ephemeris>> rtcm_eph;
+  // Received chunks are recorded here when set
+  StreamCaptureWriter *capture_{};
+
+  // Serializes the writers of the ephemeris rings, and the readers of the
+  // RTCM ephemeris port as the decoder keeps partial frames
+  std::mutex eph_write_mutex;
+
   int ssr_fd{}, eph_fd{};
   pthread_t pid_ssr{}, pid_eph{};
   bool eph_done{}, ssr_done{};
-  std::vector<SsrOrbitCorrEpoch> obt_data;
-  std::vector<SsrClockCorrEpoch> clk_data;
-  std::vector<GnssEphStruct> eph_data;
-  VTecCorrection vtec_data;
-  SsrCodeBiasEpoch code_bias;
-  SsrPhaseBiasEpoch phase_bias;
   std::string eph_log_path[3]{}, ssr_log_path[3]{};
 
   static void ClearInputStream(std::stringstream &ss, std::string &line);
   int RequestEphData();
+  int RequestRtcmEphData();
+  int DecodeEphText(const char *buf, size_t n);
+  int DecodeRtcmEph(const uint8_t *buf, size_t n);
+  int ReceiveEph(char *buf, size_t size);
+  int PublishEph(const std::vector<std::pair<char, satstruct::Ephemeris>> &
+                     new_eph);
   int RequestSsrData();
+  bool ConnectSsrPorts();
+  void CloseSsrPorts();
   static bool BkgSocketClient(int port, const char *ip, int &fd);
   void WriteSsrToLog();
   static void GpsEphParser(std::stringstream &eph_ss,
@@ -213,8 +232,6 @@ class BkgDataRequestor {
                            satstruct::Ephemeris &eph_element, gtime_t t_oc);
   static void BdsEphParser(std::stringstream &eph_ss,
                            satstruct::Ephemeris &eph_element, gtime_t t_oc);
-  static void SsrVTecParser(VTecCorrection &new_vtec, std::stringstream &ssr_ss,
-                            std::string line);
   void RequestEph();
   void RequestSsr();
   static void *RequestEphWrapper(void *arg);
@@ -225,8 +242,8 @@ class BkgDataRequestor {
   // No default constructor
   BkgDataRequestor() = delete;
   // constructor
-  explicit BkgDataRequestor(std::string log_file_path)
-      : file_path_(std::move(log_file_path)) {}
+  BkgDataRequestor(std::string log_file_path, CorrectionStore *store,
+                   BkgSource source = BkgSource::kBncText);
   ~BkgDataRequestor() {
     log_eph.close();
     log_ssr.close();
@@ -238,15 +255,12 @@ class BkgDataRequestor {
   BkgDataRequestor(BkgDataRequestor &&) = delete;
   BkgDataRequestor &operator=(BkgDataRequestor &&) = delete;
 
-  std::vector<SsrOrbitCorrEpoch> GetSatOrbitCorrEpochs();
-  std::vector<SsrClockCorrEpoch> GetSatClockCorrEpochs();
-  std::vector<GnssEphStruct> GetGnssEphDataEpochs();
-  VTecCorrection GetSsrVTecCorr();
-  SsrCodeBiasEpoch GetSsrCodeBiasCorr();
-  SsrPhaseBiasEpoch GetSsrPhaseBiasCorr();
-
   void StartRequestor();
   void EndRequestor();
+  // Record every received chunk, set before StartRequestor
+  void SetCapture(StreamCaptureWriter *capture) { capture_ = capture; }
+  // Replay: decode a recorded chunk without the ports
+  int InputStream(CaptureStream stream, const char *data, size_t n);
 };
 
 #endif  // VN_DGNSS_SERVER_BKG_DATA_REQUESTOR_H
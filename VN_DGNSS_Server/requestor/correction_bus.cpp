@@ -0,0 +1,93 @@
+#include "correction_bus.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+#include <new>
+
+#include "time_common_func.h"
+
+CorrectionBus::~CorrectionBus() { Close(); }
+
+std::string CorrectionBus::SegmentName(uint16_t port) {
+  return "/vn_dgnss_bus_" + std::to_string(port);
+}
+
+bool CorrectionBus::Create(const std::string &name) {
+  Close();
+  Remove(name);
+  int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: create bus "
+              << name << " fail! caused by " << strerror(errno) << std::endl;
+    return false;
+  }
+  if (ftruncate(fd, sizeof(Segment)) == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: size bus " << name
+              << " fail! caused by " << strerror(errno) << std::endl;
+    close(fd);
+    Remove(name);
+    return false;
+  }
+  void *base = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: map bus " << name
+              << " fail! caused by " << strerror(errno) << std::endl;
+    Remove(name);
+    return false;
+  }
+  segment_ = new (base) Segment();
+  segment_->magic = Segment::kMagic;
+  segment_->size = sizeof(Segment);
+  return true;
+}
+
+bool CorrectionBus::Open(const std::string &name, bool writable) {
+  Close();
+  int fd = shm_open(name.c_str(), writable ? O_RDWR : O_RDONLY, 0);
+  if (fd == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: open bus " << name
+              << " fail! caused by " << strerror(errno) << std::endl;
+    return false;
+  }
+  struct stat st {};
+  if (fstat(fd, &st) == -1 || (size_t)st.st_size != sizeof(Segment)) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: bus " << name
+              << " has an unexpected size" << std::endl;
+    close(fd);
+    return false;
+  }
+  void *base = mmap(nullptr, sizeof(Segment),
+                    writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED,
+                    fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: map bus " << name
+              << " fail! caused by " << strerror(errno) << std::endl;
+    return false;
+  }
+  segment_ = static_cast<Segment *>(base);
+  if (segment_->magic != Segment::kMagic ||
+      segment_->size != sizeof(Segment)) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: bus " << name
+              << " was created by another build" << std::endl;
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void CorrectionBus::Remove(const std::string &name) {
+  shm_unlink(name.c_str());
+}
+
+void CorrectionBus::Close() {
+  if (segment_ != nullptr) munmap(segment_, sizeof(Segment));
+  segment_ = nullptr;
+}
@@ -0,0 +1,56 @@
+#ifndef VN_DGNSS_SERVER_CORRECTION_BUS_H
+#define VN_DGNSS_SERVER_CORRECTION_BUS_H
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "correction_snapshot.h"
+
+// POSIX shared memory segment holding the CorrectionRings of the ingest
+// process. The ingest process creates it and writes the corrections, the
+// worker processes map it read-only and follow it with CorrectionStore.
+// The segment survives the restart of any of them.
+class CorrectionBus {
+ public:
+  // Layout of the segment
+  struct Segment {
+    static constexpr uint64_t kMagic = 0x564e44474e535342ULL;
+    uint64_t magic;
+    // Size of the segment, checked by Open as the layout depends on the build
+    uint64_t size;
+    // Set by the ingest process once every correction was received
+    std::atomic<uint32_t> ready;
+    CorrectionRings rings;
+  };
+
+  CorrectionBus() = default;
+  ~CorrectionBus();
+  CorrectionBus(const CorrectionBus &) = delete;
+  CorrectionBus &operator=(const CorrectionBus &) = delete;
+
+  // Name of the segment of a server port, e.g. "/vn_dgnss_bus_2101"
+  static std::string SegmentName(uint16_t port);
+  // Create the segment with empty rings, replacing a stale one
+  bool Create(const std::string &name);
+  // Map an existing segment, read-write for the ingest process
+  bool Open(const std::string &name, bool writable);
+  // Remove a segment, the existing mappings stay valid
+  static void Remove(const std::string &name);
+  void Close();
+
+  bool IsOpen() const { return segment_ != nullptr; }
+  CorrectionRings *Rings() { return &segment_->rings; }
+  const CorrectionRings *Rings() const { return &segment_->rings; }
+  void SetReady() { segment_->ready.store(1, std::memory_order_release); }
+  bool IsReady() const {
+    return segment_->ready.load(std::memory_order_acquire) != 0;
+  }
+
+ private:
+  Segment *segment_{};
+};
+
+#endif  // VN_DGNSS_SERVER_CORRECTION_BUS_H
@@ -0,0 +1,67 @@
+#include "correction_snapshot.h"
+
+CorrectionStore::CorrectionStore()
+    : snapshot_(std::make_shared<const CorrectionSnapshot>()),
+      owned_rings_(std::make_unique<CorrectionRings>()),
+      rings_(owned_rings_.get()),
+      view_(owned_rings_.get()) {}
+
+CorrectionStore::CorrectionStore(CorrectionRings *rings)
+    : rings_(rings), view_(rings) {
+  LoadFromRings();
+}
+
+CorrectionStore::CorrectionStore(const CorrectionRings *rings)
+    : view_(rings) {
+  LoadFromRings();
+}
+
+void CorrectionStore::LoadFromRings() {
+  auto snapshot = std::make_shared<CorrectionSnapshot>();
+  uint64_t count = view_->snapshot.Count();
+  if (count > 0 &&
+      view_->snapshot.ReadGeneration(
+          count - 1, [&](const CorrectionSnapshot &s) { *snapshot = s; })) {
+    synced_snapshot_ = count;
+  }
+  std::atomic_store(&snapshot_, std::shared_ptr<const CorrectionSnapshot>(
+                                    std::move(snapshot)));
+  version_.store(view_->version.load(std::memory_order_acquire),
+                 std::memory_order_release);
+}
+
+void CorrectionStore::Update(
+    const std::function<void(CorrectionSnapshot &)> &edit) {
+  if (rings_ == nullptr) return;
+  std::lock_guard<std::mutex> lock(update_mutex_);
+  auto next = std::make_shared<CorrectionSnapshot>(*std::atomic_load(&snapshot_));
+  edit(*next);
+  rings_->snapshot.BeginWrite() = *next;
+  rings_->snapshot.Publish();
+  std::atomic_store(&snapshot_,
+                    std::shared_ptr<const CorrectionSnapshot>(std::move(next)));
+  NotifyRingUpdate();
+}
+
+bool CorrectionStore::Sync() {
+  if (rings_ != nullptr) return false;
+  uint64_t version = view_->version.load(std::memory_order_acquire);
+  uint64_t count = view_->snapshot.Count();
+  if (version == version_.load(std::memory_order_relaxed) &&
+      count == synced_snapshot_) {
+    return false;
+  }
+  if (count != synced_snapshot_) {
+    auto next = std::make_shared<CorrectionSnapshot>();
+    // Recycled meanwhile: retry with the newer one on the next call
+    if (!view_->snapshot.ReadGeneration(
+            count - 1, [&](const CorrectionSnapshot &s) { *next = s; })) {
+      return false;
+    }
+    std::atomic_store(&snapshot_, std::shared_ptr<const CorrectionSnapshot>(
+                                      std::move(next)));
+    synced_snapshot_ = count;
+  }
+  version_.store(version, std::memory_order_release);
+  return true;
+}
@@ -0,0 +1,114 @@
+#ifndef VN_DGNSS_SERVER_CORRECTION_SNAPSHOT_H
+#define VN_DGNSS_SERVER_CORRECTION_SNAPSHOT_H
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+#include "bkg_data_requestor.h"
+#include "eph_store.h"
+#include "versioned_ring.h"
+#include "web_data_requestor.h"
+
+// Immutable set of corrections shared by every client between two updates.
+// SSR orbit/clock and broadcast ephemeris are kept in the rings of
+// CorrectionStore.
+struct CorrectionSnapshot {
+  VTecCorrection vtec_ssr;
+  SsrCodeBiasEpoch code_bias_ssr;
+  SsrPhaseBiasEpoch phase_bias_ssr;
+  UsTecCorrData ustec_data;
+  BiasCorrData code_bias;
+  BiasCorrData phase_bias;
+};
+static_assert(std::is_trivially_copyable<CorrectionSnapshot>::value,
+              "snapshots are copied into shared memory");
+
+// Number of SSR orbit/clock epochs kept per system
+static constexpr int kSsrDepth = 3;
+typedef VersionedRing<SatOrbitCorrEpoch, kSsrDepth + 1> SsrOrbitRing;
+typedef VersionedRing<SatClockCorrEpoch, kSsrDepth + 1> SsrClockRing;
+// Snapshots published by CorrectionStore::Update, for the other processes
+typedef VersionedRing<CorrectionSnapshot, 3> SnapshotRing;
+
+// Everything CorrectionStore shares with the clients: SSR orbit/clock per
+// system (0 GPS, 1 GAL, 2 BDS), ephemeris per satellite and the published
+// snapshots. Only atomics and trivially copyable slots, so it may live in a
+// shared memory segment written by one process and read by the others (see
+// correction_bus.h).
+struct CorrectionRings {
+  SsrOrbitRing orbit[3];
+  SsrClockRing clock[3];
+  SatEphStore eph[3][kMaxSsrPrn + 1];
+  SnapshotRing snapshot;
+  // Increased by every update of the snapshot or the rings
+  std::atomic<uint64_t> version{0};
+};
+
+// Holds the current CorrectionSnapshot. Requestors publish copy-on-write
+// updates, clients take a reference with one atomic load. SSR orbit/clock
+// and ephemeris (indexed by IOD, see eph_store.h) are written in place by
+// the BKG thread and read without locks.
+// A store either writes its CorrectionRings or follows rings written by
+// another process, mirroring their snapshot with Sync.
+class CorrectionStore {
+ public:
+  // Writer with its own rings
+  CorrectionStore();
+  // Writer to rings, e.g. in shared memory, starting from their contents
+  explicit CorrectionStore(CorrectionRings *rings);
+  // Follower of rings written by another process
+  explicit CorrectionStore(const CorrectionRings *rings);
+  // Non-copyable
+  CorrectionStore(const CorrectionStore &) = delete;
+  CorrectionStore &operator=(const CorrectionStore &) = delete;
+
+  // Latest published snapshot, never null
+  std::shared_ptr<const CorrectionSnapshot> Acquire() const {
+    return std::atomic_load(&snapshot_);
+  }
+  // Writer: apply edit to a copy of the latest snapshot and publish the copy
+  void Update(const std::function<void(CorrectionSnapshot &)> &edit);
+  // Follower: take the latest snapshot and version of the rings, false when
+  // nothing changed. Called periodically by a single thread.
+  bool Sync();
+
+  // The non-const accessors are for the writer only
+  SsrOrbitRing &Orbit(int sys_i) { return rings_->orbit[sys_i]; }
+  const SsrOrbitRing &Orbit(int sys_i) const { return view_->orbit[sys_i]; }
+  SsrClockRing &Clock(int sys_i) { return rings_->clock[sys_i]; }
+  const SsrClockRing &Clock(int sys_i) const { return view_->clock[sys_i]; }
+  SatEphStore &Eph(int sys_i, int prn) { return rings_->eph[sys_i][prn]; }
+  const SatEphStore &Eph(int sys_i, int prn) const {
+    return view_->eph[sys_i][prn];
+  }
+  // Writer: tell the readers that a ring was published
+  void NotifyRingUpdate() {
+    version_.store(rings_->version.fetch_add(1, std::memory_order_acq_rel) + 1,
+                   std::memory_order_release);
+  }
+  // Increased by every update of the snapshot or the rings
+  uint64_t Version() const { return version_.load(std::memory_order_acquire); }
+
+ private:
+  // Serializes publishers, readers never take it
+  std::mutex update_mutex_;
+  std::shared_ptr<const CorrectionSnapshot> snapshot_;
+  std::unique_ptr<CorrectionRings> owned_rings_;
+  // Rings written by this store, null for a follower
+  CorrectionRings *rings_{};
+  // Rings read by the clients
+  const CorrectionRings *view_{};
+  // Generation of the mirrored snapshot + 1, followers only
+  uint64_t synced_snapshot_{};
+  std::atomic<uint64_t> version_{0};
+
+  // Start from the latest snapshot and version of view_
+  void LoadFromRings();
+};
+
+#endif  // VN_DGNSS_SERVER_CORRECTION_SNAPSHOT_H
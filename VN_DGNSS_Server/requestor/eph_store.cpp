@@ -0,0 +1,40 @@
+#include "eph_store.h"
+
+void SatEphStore::Publish(const satstruct::Ephemeris &eph) {
+  uint32_t gen1 = (uint32_t)ring_.Count() + 1;
+  ring_.BeginWrite() = eph;
+  ring_.Publish();
+  // Indexed after the publish, readers validate the IOD of the slot anyway
+  if (eph.IODE < (size_t)kMaxIod) {
+    gen_by_iod_[eph.IODE].store(gen1, std::memory_order_release);
+  }
+  if (eph.svH == 0) healthy_gen_.store(gen1, std::memory_order_release);
+}
+
+bool SatEphStore::ReadIndexed(uint32_t gen1, int iod,
+                              satstruct::Ephemeris *eph) const {
+  if (gen1 == 0) return false;
+  bool match = false;
+  bool valid =
+      ring_.ReadGeneration(gen1 - 1, [&](const satstruct::Ephemeris &e) {
+        match = e.prn != -1 && (iod < 0 || (int)e.IODE == iod);
+        if (match && eph != nullptr) *eph = e;
+      });
+  return valid && match;
+}
+
+bool SatEphStore::FindByIod(int iod, satstruct::Ephemeris &eph) const {
+  if (iod < 0 || iod >= kMaxIod) return false;
+  return ReadIndexed(gen_by_iod_[iod].load(std::memory_order_acquire), iod,
+                     &eph);
+}
+
+bool SatEphStore::HasIod(int iod) const {
+  if (iod < 0 || iod >= kMaxIod) return false;
+  return ReadIndexed(gen_by_iod_[iod].load(std::memory_order_acquire), iod,
+                     nullptr);
+}
+
+bool SatEphStore::LatestHealthy(satstruct::Ephemeris &eph) const {
+  return ReadIndexed(healthy_gen_.load(std::memory_order_acquire), -1, &eph);
+}
@@ -0,0 +1,53 @@
+#ifndef VN_DGNSS_SERVER_EPH_STORE_H
+#define VN_DGNSS_SERVER_EPH_STORE_H
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+#include "constants.h"
+#include "data_struct.h"
+#include "versioned_ring.h"
+
+// Ephemeris versions of one satellite
+typedef VersionedRing<satstruct::Ephemeris, VN_MAX_NUM_OF_EPH_EPOCH + 1>
+    EphRing;
+
+// Broadcast ephemeris of one satellite: the last versions in a ring, an
+// index from IOD to the ring generation holding it and the generation of the
+// latest healthy version, so lookups read one slot instead of scanning the
+// versions. One writer (the BKG requestor), lock-free readers.
+class SatEphStore {
+ public:
+  // IODE (GPS 8 bits, BDS < 240) or IODnav (GAL 10 bits)
+  static constexpr int kMaxIod = 1024;
+
+  SatEphStore() = default;
+  SatEphStore(const SatEphStore &) = delete;
+  SatEphStore &operator=(const SatEphStore &) = delete;
+
+  // Writer: add a new version
+  void Publish(const satstruct::Ephemeris &eph);
+  // Writer: latest version, nullptr if none
+  const satstruct::Ephemeris *Latest() const { return ring_.Latest(); }
+
+  // Reader: copy of the kept version with this IOD, false if none
+  bool FindByIod(int iod, satstruct::Ephemeris &eph) const;
+  // Reader: whether a version with this IOD is kept
+  bool HasIod(int iod) const;
+  // Reader: copy of the latest version with svH == 0, false if none
+  bool LatestHealthy(satstruct::Ephemeris &eph) const;
+  const EphRing &Ring() const { return ring_; }
+
+ private:
+  EphRing ring_;
+  // Generation + 1 of the last version with an IOD, 0 if never seen
+  std::atomic<uint32_t> gen_by_iod_[kMaxIod]{};
+  // Generation + 1 of the latest healthy version, 0 if none
+  std::atomic<uint32_t> healthy_gen_{0};
+
+  // Copy of the version at gen + 1 if it still has this IOD (-1: any)
+  bool ReadIndexed(uint32_t gen1, int iod, satstruct::Ephemeris *eph) const;
+};
+
+#endif  // VN_DGNSS_SERVER_EPH_STORE_H
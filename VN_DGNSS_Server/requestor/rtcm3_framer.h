@@ -0,0 +1,84 @@
+#ifndef VN_DGNSS_SERVER_RTCM3_FRAMER_H
+#define VN_DGNSS_SERVER_RTCM3_FRAMER_H
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "rtklib.h"
+
+// Splits a RTCM 3 byte stream into CRC checked frames. Frames may span
+// several calls of Input. Bytes before a preamble are skipped; after a false
+// preamble (non zero reserved bits or CRC error) the buffered bytes are
+// searched again, so a valid frame behind it is not lost.
+class Rtcm3Framer {
+ public:
+  // Frame: preamble, 6 reserved bits, 10 bit length, message, 24 bit CRC
+  static constexpr uint8_t kPreamble = 0xD3;
+  static constexpr int kMaxFrame = 3 + 1023 + 3;
+
+  // Feed received bytes. fn(const uint8_t *buff, int len) is called for each
+  // valid frame, buff holds the 3 byte header then the message, so the
+  // message type starts at bit 24 as in rtklib; len excludes the CRC.
+  template <typename F>
+  void Input(const uint8_t *data, size_t n, F &&fn) {
+    while (true) {
+      if (nbyte_ == 0) {
+        const void *preamble = memchr(data, kPreamble, n);
+        if (preamble == nullptr) return;
+        n -= (const uint8_t *)preamble - data;
+        data = (const uint8_t *)preamble;
+      }
+      if (nbyte_ >= 3) {
+        if (buff_[1] & 0xFC) {
+          Resync();
+          continue;
+        }
+        len_ = (int)getbitu(buff_, 14, 10) + 3;
+      }
+      // Header first, then the rest of the frame
+      int need = (nbyte_ < 3 ? 3 : len_ + 3) - nbyte_;
+      if (need > 0) {
+        if (n == 0) return;
+        int take = (int)std::min<size_t>(n, need);
+        memcpy(buff_ + nbyte_, data, take);
+        nbyte_ += take;
+        data += take;
+        n -= take;
+        continue;
+      }
+      if (rtk_crc24q(buff_, len_) != getbitu(buff_, len_ * 8, 24)) {
+        num_crc_errors_++;
+        Resync();
+        continue;
+      }
+      fn((const uint8_t *)buff_, len_);
+      Drop(len_ + 3);
+    }
+  }
+  // Drop a partially received frame
+  void Reset() { nbyte_ = 0; }
+  uint32_t NumCrcErrors() const { return num_crc_errors_; }
+
+ private:
+  uint8_t buff_[kMaxFrame]{};
+  int nbyte_{}, len_{};
+  uint32_t num_crc_errors_{};
+
+  void Drop(int num) {
+    memmove(buff_, buff_ + num, nbyte_ - num);
+    nbyte_ -= num;
+  }
+  // The buffered frame is not valid, restart from the next preamble in it
+  void Resync() {
+    const void *preamble = memchr(buff_ + 1, kPreamble, nbyte_ - 1);
+    if (preamble == nullptr) {
+      nbyte_ = 0;
+    } else {
+      Drop((int)((const uint8_t *)preamble - buff_));
+    }
+  }
+};
+
+#endif  // VN_DGNSS_SERVER_RTCM3_FRAMER_H
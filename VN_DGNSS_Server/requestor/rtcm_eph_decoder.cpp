@@ -0,0 +1,237 @@
+#include "rtcm_eph_decoder.h"
+
+#include <vector>
+
+#include "time_common_func.h"
+
+// Scale factors not defined by rtklib.h
+static constexpr double kP2_34 = 5.820766091346740E-11;  // 2^-34
+static constexpr double kP2_46 = 1.421085471520200E-14;  // 2^-46
+static constexpr double kP2_59 = 1.734723475976810E-18;  // 2^-59
+static constexpr double kP2_66 = 1.355252715606881E-20;  // 2^-66
+// BDT week 0 is GPS week 1356
+static constexpr int kBdtWeekOffset = 1356;
+
+// GPS/BDS user range accuracy (m) of the URA index
+static double UraValue(int sva) {
+  static const double kUra[] = {2.4,    3.4,    4.85,   6.85,   9.65,
+                                13.65,  24.0,   48.0,   96.0,   192.0,
+                                384.0,  768.0,  1536.0, 3072.0, 6144.0};
+  return sva < 15 ? kUra[sva] : 6144.0;
+}
+
+// Galileo signal in space accuracy (m) of the SISA index
+static double SisaValue(int sisa) {
+  if (sisa <= 49) return sisa * 0.01;
+  if (sisa <= 74) return 0.5 + (sisa - 50) * 0.02;
+  if (sisa <= 99) return 1.0 + (sisa - 75) * 0.04;
+  if (sisa <= 125) return 2.0 + (sisa - 100) * 0.16;
+  // No accuracy prediction available
+  return 500.0;
+}
+
+// Truncated week number to the full week nearest now_week
+static int FullWeek(int week, int rollover, int now_week) {
+  return week + (now_week - week + rollover / 2) / rollover * rollover;
+}
+
+// t_oc within half a week of t_oe
+static gtime_t NearTime(gtime_t t, gtime_t t0) {
+  double tt = timediff(t, t0);
+  if (tt < -302400.0) return timeadd(t, 604800.0);
+  if (tt > 302400.0) return timeadd(t, -604800.0);
+  return t;
+}
+
+// Reads consecutive fields of a message
+class BitReader {
+ public:
+  BitReader(const uint8_t *buff, int pos) : buff_(buff), pos_(pos) {}
+  uint32_t U(int len) {
+    uint32_t bits = getbitu(buff_, pos_, len);
+    pos_ += len;
+    return bits;
+  }
+  double U(int len, double scale) { return U(len) * scale; }
+  double S(int len, double scale) {
+    int32_t bits = getbits(buff_, pos_, len);
+    pos_ += len;
+    return bits * scale;
+  }
+
+ private:
+  const uint8_t *buff_;
+  int pos_;
+};
+
+bool RtcmEphDecoder::Decode(const uint8_t *buff, int len, char &sys,
+                            satstruct::Ephemeris &eph) {
+  if (len < 3 + 2) return false;
+  switch (getbitu(buff, 24, 12)) {
+    case 1019:
+      sys = 'G';
+      return DecodeGps(buff, len, eph);
+    case 1045:
+      sys = 'E';
+      return DecodeGal(buff, len, false, eph);
+    case 1046:
+      sys = 'E';
+      return DecodeGal(buff, len, true, eph);
+    case 1042:
+      sys = 'C';
+      return DecodeBds(buff, len, eph);
+    default:
+      return false;
+  }
+}
+
+int RtcmEphDecoder::GpsWeekNow() {
+  if (time_.time == 0) {
+    std::vector<double> date(6);
+    int doy;
+    vntimefunc::GetGpsTimeNow(date, doy, time_);
+  }
+  int week;
+  time2gpst(time_, &week);
+  return week;
+}
+
+bool RtcmEphDecoder::DecodeGps(const uint8_t *buff, int len,
+                               satstruct::Ephemeris &eph) {
+  if (24 + 12 + 476 > len * 8) return false;
+  BitReader r(buff, 24 + 12);
+  eph = satstruct::Ephemeris();
+  eph.prn = (int)r.U(6);
+  int week = (int)r.U(10);
+  eph.svAcc = UraValue((int)r.U(4));
+  r.U(2);  // Code on L2
+  eph.IDOT = r.S(14, P2_43 * SC2RAD);
+  eph.IODE = r.U(8);
+  double toc = r.U(16, 16.0);
+  eph.a_f2 = r.S(8, P2_55);
+  eph.a_f1 = r.S(16, P2_43);
+  eph.a_f0 = r.S(22, P2_31);
+  eph.IODC = r.U(10);
+  eph.C_rs = r.S(16, P2_5);
+  eph.Delta_n = r.S(16, P2_43 * SC2RAD);
+  eph.M_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_uc = r.S(16, P2_29);
+  eph.e = r.U(32, P2_33);
+  eph.C_us = r.S(16, P2_29);
+  eph.sqrtA = r.U(32, P2_19);
+  eph.toes = r.U(16, 16.0);
+  eph.C_ic = r.S(16, P2_29);
+  eph.Omega_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_is = r.S(16, P2_29);
+  eph.i_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_rc = r.S(16, P2_5);
+  eph.omega = r.S(32, P2_31 * SC2RAD);
+  eph.OmegaDot = r.S(24, P2_43 * SC2RAD);
+  eph.T_GD = r.S(8, P2_31);
+  eph.svH = (int)r.U(6);
+  // SBAS satellites are sent as PRN 40 and above
+  if (eph.prn < 1 || eph.prn > MAXPRNGPS) return false;
+  eph.weekNo = FullWeek(week, 1024, GpsWeekNow());
+  eph.t_oe = gpst2time((int)eph.weekNo, eph.toes);
+  eph.t_oc = NearTime(gpst2time((int)eph.weekNo, toc), eph.t_oe);
+  return true;
+}
+
+bool RtcmEphDecoder::DecodeGal(const uint8_t *buff, int len, bool inav,
+                               satstruct::Ephemeris &eph) {
+  if (24 + 12 + (inav ? 492 : 484) > len * 8) return false;
+  BitReader r(buff, 24 + 12);
+  eph = satstruct::Ephemeris();
+  eph.prn = (int)r.U(6);
+  int week = (int)r.U(12);
+  eph.IODE = r.U(10);
+  eph.svAcc = SisaValue((int)r.U(8));
+  eph.IDOT = r.S(14, P2_43 * SC2RAD);
+  double toc = r.U(14, 60.0);
+  eph.a_f2 = r.S(6, kP2_59);
+  eph.a_f1 = r.S(21, kP2_46);
+  eph.a_f0 = r.S(31, kP2_34);
+  eph.C_rs = r.S(16, P2_5);
+  eph.Delta_n = r.S(16, P2_43 * SC2RAD);
+  eph.M_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_uc = r.S(16, P2_29);
+  eph.e = r.U(32, P2_33);
+  eph.C_us = r.S(16, P2_29);
+  eph.sqrtA = r.U(32, P2_19);
+  eph.toes = r.U(14, 60.0);
+  eph.C_ic = r.S(16, P2_29);
+  eph.Omega_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_is = r.S(16, P2_29);
+  eph.i_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_rc = r.S(16, P2_5);
+  eph.omega = r.S(32, P2_31 * SC2RAD);
+  eph.OmegaDot = r.S(24, P2_43 * SC2RAD);
+  // BGD E5a/E1, and E5b/E1 for I/NAV
+  eph.T_GD = r.S(10, P2_32);
+  if (inav) {
+    eph.T_GD2 = r.S(10, P2_32);
+    // E5b and E1-B signal health and data validity, RINEX bit order
+    int e5b_hs = (int)r.U(2);
+    int e5b_dvs = (int)r.U(1);
+    int e1_hs = (int)r.U(2);
+    int e1_dvs = (int)r.U(1);
+    eph.svH = (e5b_hs << 7) | (e5b_dvs << 6) | (e1_hs << 1) | e1_dvs;
+    // I/NAV E1-B and E5b, clock for E5b/E1
+    eph.data_src = (1 << 0) | (1 << 2) | (1 << 9);
+  } else {
+    int e5a_hs = (int)r.U(2);
+    int e5a_dvs = (int)r.U(1);
+    eph.svH = (e5a_hs << 4) | (e5a_dvs << 3);
+    // F/NAV E5a, clock for E5a/E1
+    eph.data_src = (1 << 1) | (1 << 8);
+  }
+  if (eph.prn < 1 || eph.prn > MAXPRNGAL) return false;
+  // GST week + 1024 is the GPS week, GST seconds are GPS seconds
+  eph.weekNo = FullWeek(week + 1024, 4096, GpsWeekNow());
+  eph.t_oe = gpst2time((int)eph.weekNo, eph.toes);
+  eph.t_oc = NearTime(gpst2time((int)eph.weekNo, toc), eph.t_oe);
+  return true;
+}
+
+bool RtcmEphDecoder::DecodeBds(const uint8_t *buff, int len,
+                               satstruct::Ephemeris &eph) {
+  if (24 + 12 + 499 > len * 8) return false;
+  BitReader r(buff, 24 + 12);
+  eph = satstruct::Ephemeris();
+  eph.prn = (int)r.U(6);
+  int week = (int)r.U(13);
+  eph.svAcc = UraValue((int)r.U(4));
+  eph.IDOT = r.S(14, P2_43 * SC2RAD);
+  r.U(5);  // AODE
+  double toc = r.U(17, 8.0);
+  eph.a_f2 = r.S(11, kP2_66);
+  eph.a_f1 = r.S(22, P2_50);
+  eph.a_f0 = r.S(24, P2_33);
+  eph.IODC = r.U(5);  // AODC
+  eph.C_rs = r.S(18, P2_6);
+  eph.Delta_n = r.S(16, P2_43 * SC2RAD);
+  eph.M_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_uc = r.S(18, P2_31);
+  eph.e = r.U(32, P2_33);
+  eph.C_us = r.S(18, P2_31);
+  eph.sqrtA = r.U(32, P2_19);
+  eph.toes = r.U(17, 8.0);
+  eph.C_ic = r.S(18, P2_31);
+  eph.Omega_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_is = r.S(18, P2_31);
+  eph.i_0 = r.S(32, P2_31 * SC2RAD);
+  eph.C_rc = r.S(18, P2_6);
+  eph.omega = r.S(32, P2_31 * SC2RAD);
+  eph.OmegaDot = r.S(24, P2_43 * SC2RAD);
+  eph.T_GD = r.S(10, 1E-10);
+  eph.T_GD2 = r.S(10, 1E-10);
+  eph.svH = (int)r.U(1);
+  if (eph.prn < 1 || eph.prn > MAXPRNCMP) return false;
+  eph.IODE = ((int)(eph.toes / 720)) % 240;
+  // Week and seconds stay in BDT, the times are in GPS time
+  eph.weekNo = FullWeek(week, 8192, GpsWeekNow() - kBdtWeekOffset);
+  eph.t_oe = bdt2gpst(bdt2time((int)eph.weekNo, eph.toes));
+  eph.t_oc =
+      NearTime(bdt2gpst(bdt2time((int)eph.weekNo, toc)), eph.t_oe);
+  return true;
+}
@@ -0,0 +1,52 @@
+#ifndef VN_DGNSS_SERVER_RTCM_EPH_DECODER_H
+#define VN_DGNSS_SERVER_RTCM_EPH_DECODER_H
+
+#pragma once
+#include "data_struct.h"
+#include "rtcm3_framer.h"
+
+// Decoder of the RTCM 3 broadcast ephemeris messages: GPS 1019, Galileo
+// F/NAV 1045 and I/NAV 1046, BDS 1042. The ephemeris follow the conventions
+// of the BNC RINEX output parsed before: GPS/GAL week and seconds (GAL week
+// aligned to GPS), t_oc/t_oe in GPS time, BDS week/toes in BDT with
+// IODE = (toe / 720) % 240, GAL data_src 517 for I/NAV and 258 for F/NAV.
+class RtcmEphDecoder {
+ public:
+  RtcmEphDecoder() = default;
+  RtcmEphDecoder(const RtcmEphDecoder &) = delete;
+  RtcmEphDecoder &operator=(const RtcmEphDecoder &) = delete;
+
+  // Feed received bytes, fn(char sys, const satstruct::Ephemeris &) is
+  // called for each ephemeris decoded, sys is 'G', 'E' or 'C'
+  template <typename F>
+  void Input(const uint8_t *data, size_t n, F &&fn) {
+    framer_.Input(data, n, [&](const uint8_t *buff, int len) {
+      char sys;
+      if (Decode(buff, len, sys, eph_)) {
+        fn(sys, (const satstruct::Ephemeris &)eph_);
+      }
+    });
+  }
+  // Decode one CRC checked frame (see Rtcm3Framer), false if it is not a
+  // supported ephemeris message
+  bool Decode(const uint8_t *buff, int len, char &sys,
+              satstruct::Ephemeris &eph);
+  // GPS time resolving the truncated week numbers, the current time when
+  // not set
+  void SetTime(gtime_t time) { time_ = time; }
+  uint32_t NumCrcErrors() const { return framer_.NumCrcErrors(); }
+
+ private:
+  Rtcm3Framer framer_;
+  gtime_t time_{};
+  satstruct::Ephemeris eph_;
+
+  bool DecodeGps(const uint8_t *buff, int len, satstruct::Ephemeris &eph);
+  bool DecodeGal(const uint8_t *buff, int len, bool inav,
+                 satstruct::Ephemeris &eph);
+  bool DecodeBds(const uint8_t *buff, int len, satstruct::Ephemeris &eph);
+  // GPS week of time_
+  int GpsWeekNow();
+};
+
+#endif  // VN_DGNSS_SERVER_RTCM_EPH_DECODER_H
@@ -0,0 +1,378 @@
+#include "rtcm_ssr_decoder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "time_common_func.h"
+
+// Message subtypes of the 6 messages of a system, 1057-1062 for GPS
+static constexpr int kSubOrbit = 1;
+static constexpr int kSubClock = 2;
+static constexpr int kSubCodeBias = 3;
+static constexpr int kSubCombined = 4;
+static constexpr int kMsgVtec = 1264;
+
+// Signal and tracking mode identifiers, in RINEX 3 code notation
+static const char *const kGpsCodes[] = {
+    "1C", "1P", "1W", "1Y", "1M", "2C", "2D", "2S", "2L", "2X",
+    "2P", "2W", "2Y", "2M", "5I", "5Q", "5X", "1S", "1L", "1X"};
+static const char *const kGloCodes[] = {"1C", "1P", "2C", "2P"};
+static const char *const kGalCodes[] = {
+    "1A", "1B", "1C", "1X", "1Z", "5I", "5Q", "5X", "7I", "7Q",
+    "7X", "8I", "8Q", "8X", "6A", "6B", "6C", "6X", "6Z"};
+static const char *const kQzsCodes[] = {
+    "1C", "1S", "1L", "2S", "2L", "2X", "5I", "5Q", "5X", "6S",
+    "6L", "6X", "1X", "1Z", "5D", "5P", "5Z", "6E", "6Z"};
+static const char *const kSbsCodes[] = {"1C", "5I", "5Q", "5X"};
+static const char *const kBdsCodes[] = {"2I", "2Q", "2X", "6I", "6Q", "6X",
+                                        "7I", "7Q", "7X", "1D", "1P", "1X",
+                                        "5D", "5P", "5X"};
+
+// Layout of the satellite specific part of a system
+struct RtcmSsrDecoder::SysInfo {
+  char sys;
+  // Message types of orbit (first of the 6) and phase bias
+  int first_type, phase_bias_type;
+  // Satellite id: bits and offset to the RINEX satellite number
+  int prn_bits, prn_offset;
+  int nsat_bits;
+  // Orbit IOD: bits before (toe modulo) and bits of the IOD
+  int iod_skip, iod_bits;
+  bool glonass_time;
+  const char *const *codes;
+  int num_codes;
+};
+
+#define VN_SSR_CODES(t) t, (int)(sizeof(t) / sizeof(t[0]))
+// BDS IOD as BNC: toe modulo then IOD = (toe / 720) % 240, SBAS IODCRC
+const RtcmSsrDecoder::SysInfo *RtcmSsrDecoder::FindSys(int type,
+                                                      bool &phase) {
+  static const SysInfo kSys[] = {
+      {'G', 1057, 1265, 6, 0, 6, 0, 8, false, VN_SSR_CODES(kGpsCodes)},
+      {'R', 1063, 1266, 5, 0, 6, 0, 8, true, VN_SSR_CODES(kGloCodes)},
+      {'E', 1240, 1267, 6, 0, 6, 0, 10, false, VN_SSR_CODES(kGalCodes)},
+      {'J', 1246, 1268, 4, 0, 4, 0, 8, false, VN_SSR_CODES(kQzsCodes)},
+      {'S', 1252, 1269, 6, 20, 6, 9, 24, false, VN_SSR_CODES(kSbsCodes)},
+      {'C', 1258, 1270, 6, 1, 6, 10, 8, false, VN_SSR_CODES(kBdsCodes)},
+  };
+  for (const auto &sys : kSys) {
+    if (type >= sys.first_type && type < sys.first_type + 6) {
+      phase = false;
+      return &sys;
+    }
+    if (type == sys.phase_bias_type) {
+      phase = true;
+      return &sys;
+    }
+  }
+  return nullptr;
+}
+#undef VN_SSR_CODES
+
+RtcmSsrDecoder::RtcmSsrDecoder(std::string_view mountpoint) {
+  size_t len = std::min(mountpoint.size(), sizeof(mountpoint_) - 1);
+  memcpy(mountpoint_, mountpoint.data(), len);
+  header_.mountpoint = std::string_view(mountpoint_, len);
+}
+
+void RtcmSsrDecoder::Input(const uint8_t *data, size_t n,
+                           SsrTextParser::Handler &handler) {
+  framer_.Input(data, n, [&](const uint8_t *buff, int len) {
+    Decode(buff, len, handler);
+  });
+}
+
+bool RtcmSsrDecoder::Decode(const uint8_t *buff, int len,
+                            SsrTextParser::Handler &handler) {
+  if (len < 3 + 2) return false;
+  int type = (int)getbitu(buff, 24, 12);
+  bool ok;
+  if (type == kMsgVtec) {
+    ok = DecodeVtec(buff, len, handler);
+  } else {
+    bool phase = false;
+    const SysInfo *sys = FindSys(type, phase);
+    if (sys == nullptr) return false;
+    int subtype = type - sys->first_type + 1;
+    if (phase) {
+      ok = DecodePhaseBias(buff, len, *sys, handler);
+    } else if (subtype == kSubCombined) {
+      // Both blocks from the same message
+      ok = DecodeSatellites(buff, len, *sys, kSubOrbit, true, handler) &&
+           DecodeSatellites(buff, len, *sys, kSubClock, true, handler);
+    } else if (subtype < kSubCombined) {
+      ok = DecodeSatellites(buff, len, *sys, subtype, false, handler);
+    } else {
+      // URA and high rate clock are not used
+      return false;
+    }
+  }
+  if (ok && !more_) EndBlocks(handler);
+  return ok;
+}
+
+bool RtcmSsrDecoder::BeginBlock(int msg, int slot,
+                                SsrTextParser::Handler &handler) {
+  if (msg == open_msg_ && slot < num_open_ &&
+      timediff(header_.time, open_[slot].header.time) == 0.0) {
+    return open_[slot].accepted;
+  }
+  // Another type or epoch ends the blocks the previous message left open
+  if (slot == 0) EndBlocks(handler);
+  open_[slot].header = header_;
+  open_[slot].accepted = handler.OnBlockBegin(header_);
+  num_open_ = slot + 1;
+  open_msg_ = msg;
+  return open_[slot].accepted;
+}
+
+void RtcmSsrDecoder::EndBlocks(SsrTextParser::Handler &handler) {
+  for (int k = 0; k < num_open_; k++) {
+    if (open_[k].accepted) handler.OnBlockEnd(open_[k].header);
+  }
+  num_open_ = 0;
+  open_msg_ = 0;
+}
+
+void RtcmSsrDecoder::SetEpoch(double sec, bool glonass) {
+  if (time_.time == 0) {
+    std::vector<double> date(6);
+    int doy;
+    vntimefunc::GetGpsTimeNow(date, doy, time_);
+  }
+  int week;
+  if (glonass) {
+    // GLONASS time of day, UTC + 3h
+    gtime_t glot = timeadd(gpst2utc(time_), 10800.0);
+    double tow = time2gpst(glot, &week);
+    double tod = fmod(tow, 86400.0);
+    tow -= tod;
+    if (sec < tod - 43200.0) {
+      sec += 86400.0;
+    } else if (sec > tod + 43200.0) {
+      sec -= 86400.0;
+    }
+    time_ = utc2gpst(timeadd(gpst2time(week, tow + sec), -10800.0));
+  } else {
+    double tow = time2gpst(time_, &week);
+    if (sec < tow - 302400.0) {
+      sec += 604800.0;
+    } else if (sec > tow + 302400.0) {
+      sec -= 604800.0;
+    }
+    time_ = gpst2time(week, sec);
+  }
+  header_.time = time_;
+  time2epoch(time_, header_.datetime);
+}
+
+int RtcmSsrDecoder::DecodeHeader(const uint8_t *buff, int len,
+                                 const SysInfo &sys, SsrBlockType type,
+                                 bool orbit, bool phase, int &pos) {
+  int time_bits = sys.glonass_time ? 17 : 20;
+  int bits = 12 + time_bits + 4 + 1 + (orbit ? 1 : 0) + 4 + 16 + 4 +
+             (phase ? 2 : 0) + sys.nsat_bits;
+  if (24 + bits > len * 8) return -1;
+  int i = 24 + 12;
+  double sec = getbitu(buff, i, time_bits);
+  i += time_bits;
+  // Update interval, multiple message, reference datum, IOD SSR, provider
+  // and solution id
+  more_ = getbitu(buff, i + 4, 1) != 0;
+  i += 4 + 1 + (orbit ? 1 : 0);
+  iod_ssr_ = (int)getbitu(buff, i, 4);
+  i += 4 + 16 + 4;
+  // Dispersive bias consistency and MW consistency
+  if (phase) i += 2;
+  int nsat = (int)getbitu(buff, i, sys.nsat_bits);
+  i += sys.nsat_bits;
+  pos = i;
+  header_.type = type;
+  header_.num_records = nsat;
+  SetEpoch(sec, sys.glonass_time);
+  return nsat;
+}
+
+bool RtcmSsrDecoder::DecodeSatellites(const uint8_t *buff, int len,
+                                      const SysInfo &sys, int subtype,
+                                      bool combined,
+                                      SsrTextParser::Handler &handler) {
+  bool has_orbit = subtype == kSubOrbit || combined;
+  bool has_clock = subtype == kSubClock || combined;
+  SsrBlockType type = subtype == kSubOrbit       ? SsrBlockType::kOrbit
+                      : subtype == kSubCodeBias ? SsrBlockType::kCodeBias
+                                                : SsrBlockType::kClock;
+  int i;
+  int nsat = DecodeHeader(buff, len, sys, type, has_orbit, false, i);
+  if (nsat < 0) return false;
+  int msg = sys.first_type + (combined ? kSubCombined : subtype) - 1;
+  bool skip =
+      !BeginBlock(msg, combined && subtype == kSubClock ? 1 : 0, handler);
+  int end = len * 8;
+  for (int j = 0; j < nsat && !skip; j++) {
+    SsrSatRecord &rec = record_;
+    rec.sys = sys.sys;
+    rec.num_bias = 0;
+    // Clock only records have no orbit IOD
+    rec.iod = iod_ssr_;
+    if (i + sys.prn_bits > end) break;
+    rec.prn = (int)getbitu(buff, i, sys.prn_bits) + sys.prn_offset;
+    i += sys.prn_bits;
+    if (subtype == kSubCodeBias) {
+      if (i + 5 > end) break;
+      int nbias = (int)getbitu(buff, i, 5);
+      i += 5;
+      if (i + nbias * 19 > end) break;
+      for (int k = 0; k < nbias; k++) {
+        int mode = (int)getbitu(buff, i, 5);
+        double value = getbits(buff, i + 5, 14) * 0.01;
+        i += 19;
+        if (mode >= sys.num_codes || rec.num_bias >= SsrSatRecord::kMaxBias ||
+            !*sys.codes[mode]) {
+          continue;
+        }
+        rec.bias[rec.num_bias].code = sys.codes[mode];
+        rec.bias[rec.num_bias].value = value;
+        rec.num_bias++;
+      }
+      handler.OnSatRecord(header_, rec);
+      continue;
+    }
+    int bits = (has_orbit ? sys.iod_skip + sys.iod_bits + 121 : 0) +
+               (has_clock ? 70 : 0);
+    if (i + bits > end) break;
+    if (has_orbit) {
+      i += sys.iod_skip;
+      rec.iod = (int)getbitu(buff, i, sys.iod_bits);
+      i += sys.iod_bits;
+      // Radial, along and cross track, then their rates
+      double deph[3], ddeph[3];
+      deph[0] = getbits(buff, i, 22) * 1E-4;
+      i += 22;
+      deph[1] = getbits(buff, i, 20) * 4E-4;
+      i += 20;
+      deph[2] = getbits(buff, i, 20) * 4E-4;
+      i += 20;
+      ddeph[0] = getbits(buff, i, 21) * 1E-6;
+      i += 21;
+      ddeph[1] = getbits(buff, i, 19) * 4E-6;
+      i += 19;
+      ddeph[2] = getbits(buff, i, 19) * 4E-6;
+      i += 19;
+      if (subtype == kSubOrbit) {
+        for (int k = 0; k < 3; k++) {
+          rec.values[k] = deph[k];
+          rec.values[3 + k] = ddeph[k];
+        }
+      }
+    }
+    if (has_clock) {
+      double dclk[3];
+      dclk[0] = getbits(buff, i, 22) * 1E-4;
+      i += 22;
+      dclk[1] = getbits(buff, i, 21) * 1E-6;
+      i += 21;
+      dclk[2] = getbits(buff, i, 27) * 2E-8;
+      i += 27;
+      if (subtype == kSubClock) {
+        for (int k = 0; k < 3; k++) rec.values[k] = dclk[k];
+      }
+    }
+    handler.OnSatRecord(header_, rec);
+  }
+  return true;
+}
+
+bool RtcmSsrDecoder::DecodePhaseBias(const uint8_t *buff, int len,
+                                     const SysInfo &sys,
+                                     SsrTextParser::Handler &handler) {
+  int i;
+  int nsat =
+      DecodeHeader(buff, len, sys, SsrBlockType::kPhaseBias, false, true, i);
+  if (nsat < 0) return false;
+  bool skip = !BeginBlock(sys.phase_bias_type, 0, handler);
+  int end = len * 8;
+  for (int j = 0; j < nsat && !skip; j++) {
+    SsrSatRecord &rec = record_;
+    rec.sys = sys.sys;
+    rec.num_bias = 0;
+    if (i + sys.prn_bits + 5 + 9 + 8 > end) break;
+    rec.prn = (int)getbitu(buff, i, sys.prn_bits) + sys.prn_offset;
+    i += sys.prn_bits;
+    int nbias = (int)getbitu(buff, i, 5);
+    i += 5;
+    // Yaw angle (1/256 semicircle) and rate (1/8192 semicircle/s)
+    rec.yaw_deg = getbitu(buff, i, 9) / 256.0 * 180.0;
+    i += 9;
+    rec.yaw_rate = getbits(buff, i, 8) / 8192.0 * 180.0;
+    i += 8;
+    if (i + nbias * 32 > end) break;
+    for (int k = 0; k < nbias; k++) {
+      // Mode, integer, wide lane and discontinuity indicators, bias
+      int mode = (int)getbitu(buff, i, 5);
+      double value = getbits(buff, i + 12, 20) * 1E-4;
+      i += 32;
+      if (mode >= sys.num_codes || rec.num_bias >= SsrSatRecord::kMaxBias ||
+          !*sys.codes[mode]) {
+        continue;
+      }
+      rec.bias[rec.num_bias].code = sys.codes[mode];
+      rec.bias[rec.num_bias].value = value;
+      rec.num_bias++;
+    }
+    handler.OnSatRecord(header_, rec);
+  }
+  return true;
+}
+
+bool RtcmSsrDecoder::DecodeVtec(const uint8_t *buff, int len,
+                                SsrTextParser::Handler &handler) {
+  // Type, epoch time, update interval, multiple message, IOD SSR, provider
+  // and solution id, quality, number of layers
+  int i = 24 + 12;
+  if (i + 20 + 4 + 1 + 4 + 16 + 4 + 9 + 2 > len * 8) return false;
+  double sec = getbitu(buff, i, 20);
+  more_ = getbitu(buff, i + 20 + 4, 1) != 0;
+  i += 20 + 4 + 1 + 4 + 16 + 4 + 9;
+  int nlayer = (int)getbitu(buff, i, 2) + 1;
+  i += 2;
+  header_.type = SsrBlockType::kVtec;
+  header_.num_records = nlayer;
+  SetEpoch(sec, false);
+  bool skip = !BeginBlock(kMsgVtec, 0, handler);
+  int end = len * 8;
+  for (int l = 0; l < nlayer && !skip; l++) {
+    SsrVtecLayer &layer = layer_;
+    if (i + 16 > end) break;
+    layer.index = l + 1;
+    layer.height_m = getbitu(buff, i, 8) * 10000.0;
+    layer.num_deg = (int)getbitu(buff, i + 8, 4) + 1;
+    layer.num_ord = (int)getbitu(buff, i + 12, 4) + 1;
+    i += 16;
+    int deg = layer.num_deg, ord = layer.num_ord;
+    // Cosine terms of order 0..ord and sine terms of order 1..ord, 16 bits
+    // each
+    int num_coeffs = 0;
+    for (int o = 0; o <= ord; o++) {
+      num_coeffs += std::max(0, deg - o + 1) * (o == 0 ? 1 : 2);
+    }
+    if (i + num_coeffs * 16 > end) break;
+    std::fill(layer.cos_coeffs, layer.cos_coeffs + SsrVtecLayer::kMaxCoeffs,
+              0.0);
+    std::fill(layer.sin_coeffs, layer.sin_coeffs + SsrVtecLayer::kMaxCoeffs,
+              0.0);
+    for (int o = 0; o <= ord; o++) {
+      for (int d = o; d <= deg; d++, i += 16) {
+        layer.cos_coeffs[d * (ord + 1) + o] = getbits(buff, i, 16) * 0.005;
+      }
+    }
+    for (int o = 1; o <= ord; o++) {
+      for (int d = o; d <= deg; d++, i += 16) {
+        layer.sin_coeffs[d * (ord + 1) + o] = getbits(buff, i, 16) * 0.005;
+      }
+    }
+    handler.OnVtecLayer(header_, layer);
+  }
+  return true;
+}
@@ -0,0 +1,83 @@
+#ifndef VN_DGNSS_SERVER_RTCM_SSR_DECODER_H
+#define VN_DGNSS_SERVER_RTCM_SSR_DECODER_H
+
+#pragma once
+#include <string_view>
+
+#include "rtcm3_framer.h"
+#include "ssr_text_parser.h"
+
+// Decoder of the RTCM 3 SSR messages of a correction stream:
+// orbit/clock/code bias/combined 1057-1068 and 1240-1263, VTEC 1264 and
+// phase bias 1265-1270. Messages are passed to the same Handler as the BNC
+// text parser, in the units of the BNC text output (m, m/s, deg, TECU), so
+// both sources feed the store the same way. A block spans the messages of
+// the same type and epoch sent with the multiple message indicator set, it
+// ends with the message that clears it, or at the next type or epoch.
+class RtcmSsrDecoder {
+ public:
+  // mountpoint: name of the stream reported in the block headers
+  explicit RtcmSsrDecoder(std::string_view mountpoint);
+  RtcmSsrDecoder(const RtcmSsrDecoder &) = delete;
+  RtcmSsrDecoder &operator=(const RtcmSsrDecoder &) = delete;
+
+  // Feed received bytes, frames may span several calls
+  void Input(const uint8_t *data, size_t n, SsrTextParser::Handler &handler);
+  // Decode one CRC checked frame (see Rtcm3Framer), false if it is not a
+  // supported SSR message
+  bool Decode(const uint8_t *buff, int len, SsrTextParser::Handler &handler);
+  // GPS time resolving the week of the message epochs, the current time
+  // when not set
+  void SetTime(gtime_t time) { time_ = time; }
+  uint32_t NumCrcErrors() const { return framer_.NumCrcErrors(); }
+
+ private:
+  struct SysInfo;
+
+  Rtcm3Framer framer_;
+  char mountpoint_[32]{};
+  gtime_t time_{};
+  SsrBlockHeader header_;
+  SsrSatRecord record_;
+  SsrVtecLayer layer_;
+  // IOD SSR and multiple message indicator of the message being decoded
+  int iod_ssr_{};
+  bool more_{};
+  // Blocks open until the last message of their type and epoch, combined
+  // messages open an orbit and a clock block
+  struct OpenBlock {
+    SsrBlockHeader header;
+    bool accepted;
+  };
+  OpenBlock open_[2]{};
+  int num_open_{};
+  // Message type of the open blocks
+  int open_msg_{};
+
+  // System of an orbit/clock/bias message type, phase is set for the phase
+  // bias messages. nullptr if not a SSR message of a system.
+  static const SysInfo *FindSys(int type, bool &phase);
+
+  // Message header, pos is moved to the first satellite. Number of
+  // satellites, -1 on error.
+  int DecodeHeader(const uint8_t *buff, int len, const SysInfo &sys,
+                   SsrBlockType type, bool orbit, bool phase, int &pos);
+  // Orbit, clock or code bias block; combined messages hold orbit and clock
+  bool DecodeSatellites(const uint8_t *buff, int len, const SysInfo &sys,
+                        int subtype, bool combined,
+                        SsrTextParser::Handler &handler);
+  bool DecodePhaseBias(const uint8_t *buff, int len, const SysInfo &sys,
+                       SsrTextParser::Handler &handler);
+  bool DecodeVtec(const uint8_t *buff, int len,
+                  SsrTextParser::Handler &handler);
+  // Begin block slot (1: clock block of a combined message) of message type
+  // msg, or continue it after a message of the same type and epoch with the
+  // multiple message indicator set. False if the handler skips it.
+  bool BeginBlock(int msg, int slot, SsrTextParser::Handler &handler);
+  void EndBlocks(SsrTextParser::Handler &handler);
+  // Epoch time of the header from the GPS time of week (GLONASS: time of
+  // day), near time_
+  void SetEpoch(double sec, bool glonass);
+};
+
+#endif  // VN_DGNSS_SERVER_RTCM_SSR_DECODER_H
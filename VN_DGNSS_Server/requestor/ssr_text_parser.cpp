@@ -0,0 +1,221 @@
+#include "ssr_text_parser.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstring>
+
+// Next whitespace separated token of rest, empty at the end of the line
+static std::string_view NextToken(std::string_view &rest) {
+  size_t begin = 0;
+  while (begin < rest.size() && (rest[begin] == ' ' || rest[begin] == '\t')) {
+    begin++;
+  }
+  size_t end = begin;
+  while (end < rest.size() && rest[end] != ' ' && rest[end] != '\t') end++;
+  std::string_view token = rest.substr(begin, end - begin);
+  rest.remove_prefix(end);
+  return token;
+}
+
+template <typename T>
+static bool ParseNumber(std::string_view &rest, T &value) {
+  std::string_view token = NextToken(rest);
+  if (token.empty()) return false;
+  auto result = std::from_chars(token.data(), token.data() + token.size(),
+                                value);
+  return result.ec == std::errc() && result.ptr == token.data() + token.size();
+}
+
+SsrTextParser::SsrTextParser(size_t capacity)
+    : buf_(new char[capacity]), capacity_(capacity) {}
+
+void SsrTextParser::Reset() {
+  size_ = 0;
+  in_block_ = false;
+  vtec_rows_ = 0;
+}
+
+void SsrTextParser::Parse(Handler &handler) {
+  size_t begin = 0;
+  while (begin < size_) {
+    const char *start = buf_.get() + begin;
+    const char *newline =
+        static_cast<const char *>(memchr(start, '\n', size_ - begin));
+    if (newline == nullptr) break;
+    size_t len = newline - start;
+    if (len > 0 && start[len - 1] == '\r') len--;
+    ParseLine(std::string_view(start, len), handler);
+    begin = newline - buf_.get() + 1;
+  }
+  // Keep the partial last line for the next call
+  if (begin > 0) {
+    memmove(buf_.get(), buf_.get() + begin, size_ - begin);
+    size_ -= begin;
+  } else if (size_ == capacity_) {
+    // A line longer than the buffer, drop it
+    size_ = 0;
+  }
+  // Without a record count the block ends with the received data
+  if (in_block_ && header_.num_records < 0 && vtec_rows_ == 0) {
+    EndBlock(handler);
+  }
+}
+
+void SsrTextParser::ParseLine(std::string_view line, Handler &handler) {
+  if (line.empty()) return;
+  if (line[0] == '>') {
+    if (in_block_) EndBlock(handler);
+    if (!ParseHeader(line)) return;
+    in_block_ = true;
+    records_ = 0;
+    vtec_rows_ = 0;
+    skip_block_ = !handler.OnBlockBegin(header_);
+    if (header_.num_records == 0) EndBlock(handler);
+    return;
+  }
+  if (!in_block_) return;
+  if (header_.type == SsrBlockType::kVtec) {
+    ParseVtecLine(line, handler);
+    return;
+  }
+  // Satellite lines start with the system letter, others (e.g. the
+  // consistency indicators of PHASE_BIAS) are not records
+  if (!isalpha((unsigned char)line[0])) return;
+  if (!skip_block_ && ParseSatRecord(line)) {
+    handler.OnSatRecord(header_, record_);
+  }
+  CountRecord(handler);
+}
+
+bool SsrTextParser::ParseHeader(std::string_view line) {
+  std::string_view rest = line.substr(1);
+  std::string_view type = NextToken(rest);
+  if (type == "CLOCK") {
+    header_.type = SsrBlockType::kClock;
+  } else if (type == "ORBIT") {
+    header_.type = SsrBlockType::kOrbit;
+  } else if (type == "CODE_BIAS") {
+    header_.type = SsrBlockType::kCodeBias;
+  } else if (type == "PHASE_BIAS") {
+    header_.type = SsrBlockType::kPhaseBias;
+  } else if (type == "VTEC") {
+    header_.type = SsrBlockType::kVtec;
+  } else {
+    return false;
+  }
+  for (double &ep : header_.datetime) {
+    if (!ParseNumber(rest, ep)) return false;
+  }
+  header_.time = epoch2time(header_.datetime);
+  // Update interval, number of records and mountpoint follow
+  std::string_view tail[3];
+  int num_tail = 0;
+  for (; num_tail < 3; num_tail++) {
+    tail[num_tail] = NextToken(rest);
+    if (tail[num_tail].empty()) break;
+  }
+  header_.num_records = -1;
+  std::string_view mountpoint;
+  if (num_tail > 0) mountpoint = tail[num_tail - 1];
+  if (num_tail == 3) {
+    int num = -1;
+    auto result = std::from_chars(tail[1].data(),
+                                  tail[1].data() + tail[1].size(), num);
+    if (result.ec == std::errc() && num >= 0) header_.num_records = num;
+  }
+  size_t len = std::min(mountpoint.size(), sizeof(mountpoint_) - 1);
+  memcpy(mountpoint_, mountpoint.data(), len);
+  header_.mountpoint = std::string_view(mountpoint_, len);
+  return true;
+}
+
+bool SsrTextParser::ParseSatRecord(std::string_view line) {
+  SsrSatRecord &rec = record_;
+  rec.sys = line[0];
+  rec.num_bias = 0;
+  std::string_view rest = line.substr(1);
+  if (!ParseNumber(rest, rec.prn)) return false;
+  switch (header_.type) {
+    case SsrBlockType::kClock:
+      if (!ParseNumber(rest, rec.iod)) return false;
+      for (int k = 0; k < 3; k++) {
+        if (!ParseNumber(rest, rec.values[k])) return false;
+      }
+      return true;
+    case SsrBlockType::kOrbit:
+      if (!ParseNumber(rest, rec.iod)) return false;
+      for (int k = 0; k < 6; k++) {
+        if (!ParseNumber(rest, rec.values[k])) return false;
+      }
+      return true;
+    case SsrBlockType::kCodeBias:
+    case SsrBlockType::kPhaseBias: {
+      bool phase = header_.type == SsrBlockType::kPhaseBias;
+      if (phase && !(ParseNumber(rest, rec.yaw_deg) &&
+                     ParseNumber(rest, rec.yaw_rate))) {
+        return false;
+      }
+      int num;
+      if (!ParseNumber(rest, num)) return false;
+      for (int i = 0; i < num && rec.num_bias < SsrSatRecord::kMaxBias; i++) {
+        SsrSatRecord::Bias &bias = rec.bias[rec.num_bias];
+        bias.code = NextToken(rest);
+        if (bias.code.empty() || !ParseNumber(rest, bias.value)) break;
+        // Integer, wide lane and discontinuity indicators
+        if (phase) {
+          for (int k = 0; k < 3; k++) NextToken(rest);
+        }
+        rec.num_bias++;
+      }
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+void SsrTextParser::ParseVtecLine(std::string_view line, Handler &handler) {
+  std::string_view rest = line;
+  if (vtec_rows_ == 0) {
+    // Layer line: index, degree, order, height
+    SsrVtecLayer &l = layer_;
+    if (!(ParseNumber(rest, l.index) && ParseNumber(rest, l.num_deg) &&
+          ParseNumber(rest, l.num_ord) && ParseNumber(rest, l.height_m))) {
+      return;
+    }
+    if (l.num_deg < 0 || l.num_ord < 0) return;
+    // Cosine then sine coefficients, one line per degree
+    vtec_rows_ = 2 * (l.num_deg + 1);
+    vtec_row_ = 0;
+    return;
+  }
+  SsrVtecLayer &l = layer_;
+  bool fits = l.num_deg <= SsrVtecLayer::kMaxDegree &&
+              l.num_ord <= SsrVtecLayer::kMaxDegree;
+  if (fits) {
+    int deg = vtec_row_ % (l.num_deg + 1);
+    double *row = (vtec_row_ <= l.num_deg ? l.cos_coeffs : l.sin_coeffs) +
+                  deg * (l.num_ord + 1);
+    for (int ord = 0; ord <= l.num_ord; ord++) {
+      if (!ParseNumber(rest, row[ord])) row[ord] = 0.0;
+    }
+  }
+  if (++vtec_row_ < vtec_rows_) return;
+  vtec_rows_ = 0;
+  if (fits && !skip_block_) handler.OnVtecLayer(header_, l);
+  CountRecord(handler);
+}
+
+void SsrTextParser::CountRecord(Handler &handler) {
+  records_++;
+  if (header_.num_records >= 0 && records_ >= header_.num_records) {
+    EndBlock(handler);
+  }
+}
+
+void SsrTextParser::EndBlock(Handler &handler) {
+  if (!skip_block_) handler.OnBlockEnd(header_);
+  in_block_ = false;
+  vtec_rows_ = 0;
+}
@@ -0,0 +1,116 @@
+#ifndef VN_DGNSS_SERVER_SSR_TEXT_PARSER_H
+#define VN_DGNSS_SERVER_SSR_TEXT_PARSER_H
+
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+#include "rtklib.h"
+
+enum class SsrBlockType { kNone, kClock, kOrbit, kCodeBias, kPhaseBias, kVtec };
+
+// Header line of a SSR block of the BNC text output, e.g.
+// "> ORBIT 2015 06 17 11 43 35.0 2 53 SSRA00WHU0"
+struct SsrBlockHeader {
+  SsrBlockType type{SsrBlockType::kNone};
+  double datetime[6]{};
+  gtime_t time{};
+  // Number of records announced by the header, -1 if unknown
+  int num_records{-1};
+  // Valid until the next call of the parser
+  std::string_view mountpoint;
+};
+
+// One satellite line of a CLOCK, ORBIT, CODE_BIAS or PHASE_BIAS block
+struct SsrSatRecord {
+  static constexpr int kMaxBias = 16;
+  struct Bias {
+    // Valid until the next call of the parser
+    std::string_view code;
+    double value;
+  };
+  char sys{};
+  int prn{-1};
+  int iod{};
+  // CLOCK: 3 clock polynomial terms, ORBIT: radial/along/cross and rates
+  double values[6]{};
+  // PHASE_BIAS only
+  double yaw_deg{}, yaw_rate{};
+  int num_bias{};
+  Bias bias[kMaxBias]{};
+};
+
+// One layer of a VTEC block, coefficients indexed [deg * (num_ord + 1) + ord]
+struct SsrVtecLayer {
+  static constexpr int kMaxDegree = 16;
+  static constexpr int kMaxCoeffs = (kMaxDegree + 1) * (kMaxDegree + 1);
+  int index{};
+  int num_deg{}, num_ord{};
+  double height_m{};
+  double cos_coeffs[kMaxCoeffs]{};
+  double sin_coeffs[kMaxCoeffs]{};
+};
+
+// Incremental parser of the BNC SSR text stream. Received bytes are appended
+// to a persistent buffer, complete lines are parsed in place and the last
+// partial line is kept for the next call, so records split across recv calls
+// are not lost. Blocks may span several calls too. No allocation after
+// construction.
+class SsrTextParser {
+ public:
+  class Handler {
+   public:
+    virtual ~Handler() = default;
+    // Return false to skip the records of the block
+    virtual bool OnBlockBegin(const SsrBlockHeader &header) = 0;
+    virtual void OnSatRecord(const SsrBlockHeader &header,
+                             const SsrSatRecord &record) = 0;
+    virtual void OnVtecLayer(const SsrBlockHeader &header,
+                             const SsrVtecLayer &layer) = 0;
+    // All the announced records were parsed, or the block was cut short by
+    // the next header
+    virtual void OnBlockEnd(const SsrBlockHeader &header) = 0;
+  };
+
+  explicit SsrTextParser(size_t capacity = kDefaultCapacity);
+  SsrTextParser(const SsrTextParser &) = delete;
+  SsrTextParser &operator=(const SsrTextParser &) = delete;
+
+  // Free space at the end of the buffer to receive into
+  char *WritePtr() { return buf_.get() + size_; }
+  size_t WriteSpace() const { return capacity_ - size_; }
+  // n bytes were written at WritePtr
+  void Commit(size_t n) { size_ += n; }
+  // Parse the complete lines received so far
+  void Parse(Handler &handler);
+  // Drop the buffered bytes and the open block
+  void Reset();
+
+ private:
+  static constexpr size_t kDefaultCapacity = 256 * 1024;
+
+  std::unique_ptr<char[]> buf_;
+  const size_t capacity_;
+  size_t size_{};
+
+  // Block being parsed, its mountpoint is copied as the buffer moves
+  SsrBlockHeader header_;
+  char mountpoint_[32]{};
+  bool in_block_{}, skip_block_{};
+  int records_{};
+  // VTEC layer being parsed, coefficient lines still expected
+  SsrVtecLayer layer_;
+  int vtec_row_{}, vtec_rows_{};
+  SsrSatRecord record_;
+
+  void ParseLine(std::string_view line, Handler &handler);
+  bool ParseHeader(std::string_view line);
+  bool ParseSatRecord(std::string_view line);
+  void ParseVtecLine(std::string_view line, Handler &handler);
+  void EndBlock(Handler &handler);
+  // One more record of the block, ends it when all were parsed
+  void CountRecord(Handler &handler);
+};
+
+#endif  // VN_DGNSS_SERVER_SSR_TEXT_PARSER_H
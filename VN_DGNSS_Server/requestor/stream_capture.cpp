@@ -0,0 +1,95 @@
+#include "stream_capture.h"
+
+#include <sys/time.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include "time_common_func.h"
+
+constexpr char CaptureFileHeader::kMagic[8];
+
+static constexpr uint32_t kCaptureVersion = 1;
+
+bool StreamCaptureWriter::Open(const std::string &path) {
+  Close();
+  fp_ = fopen(path.c_str(), "wb");
+  if (fp_ == nullptr) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: open capture "
+              << path << " fail! caused by " << strerror(errno) << std::endl;
+    return false;
+  }
+  CaptureFileHeader header{};
+  memcpy(header.magic, CaptureFileHeader::kMagic, sizeof(header.magic));
+  header.version = kCaptureVersion;
+  fwrite(&header, sizeof(header), 1, fp_);
+  return true;
+}
+
+void StreamCaptureWriter::Close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (fp_ != nullptr) {
+    fclose(fp_);
+    fp_ = nullptr;
+  }
+}
+
+void StreamCaptureWriter::Write(CaptureStream stream, const void *data,
+                                size_t n) {
+  timeval tv{};
+  gettimeofday(&tv, nullptr);
+  CaptureRecordHeader record{};
+  record.gpst_ms = (int64_t)(tv.tv_sec + vntimefunc::kGpsLeapSeconds) * 1000 +
+                   tv.tv_usec / 1000;
+  record.length = (uint32_t)n;
+  record.stream = (uint8_t)stream;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (fp_ == nullptr) return;
+  fwrite(&record, sizeof(record), 1, fp_);
+  fwrite(data, 1, n, fp_);
+}
+
+bool StreamCaptureReader::Open(const std::string &path) {
+  Close();
+  fp_ = fopen(path.c_str(), "rb");
+  if (fp_ == nullptr) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: open capture "
+              << path << " fail! caused by " << strerror(errno) << std::endl;
+    return false;
+  }
+  CaptureFileHeader header{};
+  if (fread(&header, sizeof(header), 1, fp_) != 1 ||
+      memcmp(header.magic, CaptureFileHeader::kMagic, sizeof(header.magic)) !=
+          0 ||
+      header.version != kCaptureVersion) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: open capture "
+              << path << " fail! caused by unknown file format" << std::endl;
+    Close();
+    return false;
+  }
+  return true;
+}
+
+void StreamCaptureReader::Close() {
+  if (fp_ != nullptr) {
+    fclose(fp_);
+    fp_ = nullptr;
+  }
+}
+
+bool StreamCaptureReader::Next(CaptureStream &stream, gtime_t &gpst,
+                               std::vector<char> &data) {
+  if (fp_ == nullptr) return false;
+  CaptureRecordHeader record{};
+  if (fread(&record, sizeof(record), 1, fp_) != 1) return false;
+  data.resize(record.length);
+  if (record.length > 0 && fread(data.data(), 1, record.length, fp_) !=
+                                record.length) {
+    return false;
+  }
+  stream = (CaptureStream)record.stream;
+  gpst.time = (time_t)(record.gpst_ms / 1000);
+  gpst.sec = (double)(record.gpst_ms % 1000) / 1000.0;
+  return true;
+}
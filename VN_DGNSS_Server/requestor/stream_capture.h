@@ -0,0 +1,77 @@
+#ifndef VN_DGNSS_SERVER_STREAM_CAPTURE_H
+#define VN_DGNSS_SERVER_STREAM_CAPTURE_H
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "rtklib.h"
+
+// Streams received from BKG, recorded by the server and fed back by the
+// replay (see BkgDataRequestor::InputStream)
+enum class CaptureStream : uint8_t {
+  // BNC text ephemeris and SSR corrections
+  kEphText = 0,
+  kSsrText = 1,
+  // Raw RTCM 3 ephemeris, WHU orbit/clock and CNE biases/VTEC
+  kEphRtcm = 2,
+  kSsrWhuRtcm = 3,
+  kSsrCneRtcm = 4
+};
+
+// Capture file: the header, then one record per received chunk, in the
+// order of reception. Chunks are kept as received so that records split
+// between two chunks are parsed the same way on replay.
+struct CaptureFileHeader {
+  static constexpr char kMagic[8] = {'V', 'N', 'D', 'G', 'C', 'A', 'P', '1'};
+  char magic[8];
+  uint32_t version;
+  uint32_t reserved;
+};
+
+struct CaptureRecordHeader {
+  // GPS time of reception in milliseconds since 1970
+  int64_t gpst_ms;
+  uint32_t length;
+  uint8_t stream;
+  uint8_t reserved[3];
+};
+
+class StreamCaptureWriter {
+ public:
+  StreamCaptureWriter() = default;
+  ~StreamCaptureWriter() { Close(); }
+  StreamCaptureWriter(const StreamCaptureWriter &) = delete;
+  StreamCaptureWriter &operator=(const StreamCaptureWriter &) = delete;
+
+  bool Open(const std::string &path);
+  void Close();
+  // Record a chunk received now, called by the EPH and SSR threads
+  void Write(CaptureStream stream, const void *data, size_t n);
+
+ private:
+  std::mutex mutex_;
+  FILE *fp_{};
+};
+
+class StreamCaptureReader {
+ public:
+  StreamCaptureReader() = default;
+  ~StreamCaptureReader() { Close(); }
+  StreamCaptureReader(const StreamCaptureReader &) = delete;
+  StreamCaptureReader &operator=(const StreamCaptureReader &) = delete;
+
+  bool Open(const std::string &path);
+  void Close();
+  // Next record, false at the end of the file or on a truncated record
+  bool Next(CaptureStream &stream, gtime_t &gpst, std::vector<char> &data);
+
+ private:
+  FILE *fp_{};
+};
+
+#endif  // VN_DGNSS_SERVER_STREAM_CAPTURE_H
@@ -1,6 +1,7 @@
-
 #include "web_data_requestor.h"
 
+#include "correction_snapshot.h"
+
 // Write function for curl
 size_t WebDataRequestor::WriteToBuffer(void *ptr, size_t size, size_t nmemb,
                                        void *userdata) {
@@ -153,19 +154,20 @@ bool WebDataRequestor::RequestUsTecData() {
           continue;
         }
         std::stringstream ss(line);
-        std::vector<int> row;
+        int *row = new_ustec_data.grid[new_ustec_data.num_rows];
+        int &len = new_ustec_data.row_len[new_ustec_data.num_rows];
         int val;
-        while (ss >> val) {
-          row.push_back(val);
+        while (len < UsTecCorrData::kMaxCol && ss >> val) {
+          row[len++] = val;
         }
-        new_ustec_data.data.push_back(row);
         // Only the first USETEC_NUM_ROW lines are needed
-        if (new_ustec_data.data.size() >= kUsTecNumRow) {
+        if (++new_ustec_data.num_rows >= kUsTecNumRow) {
           break;
         }
       }
-      std::lock_guard<std::mutex> lock(ustec_mutex);
-      ustec_data = new_ustec_data;
+      store_->Update([&](CorrectionSnapshot &corr) {
+        corr.ustec_data = new_ustec_data;
+      });
     }
     curl_easy_cleanup(curl);
     curl_global_cleanup();
@@ -283,18 +285,59 @@ std::optional<BiasCorrData> WebDataRequestor::ParseBiasFromBuff(
     VALUE_ss >> value;
     if (PRN[0] == 'G') {
       int sv_prn = std::stoi(PRN.substr(1, line.size() - 1));
+      if (sv_prn < 1 || sv_prn > MAXPRNGPS) continue;
       ReadGpsBiasCorr(sv_prn, value, TYPE, new_bias);
     } else if (PRN[0] == 'E') {
       int sv_prn = std::stoi(PRN.substr(1, line.size() - 1));
+      if (sv_prn < 1 || sv_prn > MAXPRNGAL) continue;
       ReadGalBiasCorr(sv_prn, value, TYPE, new_bias);
     } else if (PRN[0] == 'C') {
       int sv_prn = std::stoi(PRN.substr(1, line.size() - 1));
+      if (sv_prn < 1 || sv_prn > MAXPRNCMP) continue;
       ReadBdsBiasCorr(sv_prn, value, TYPE, new_bias);
     }
   }
   return new_bias;
 }
 
+// Read a Bias-SINEX file, gzip compressed or not
+bool WebDataRequestor::ReadGzFile(const std::string &path,
+                                  std::vector<char> &data) {
+  gzFile fp = gzopen(path.c_str(), "rb");
+  if (fp == nullptr) {
+    return false;
+  }
+  const int bufferSize = 4096;
+  char sub_data_buff[bufferSize];
+  int bytesRead;
+  while ((bytesRead = gzread(fp, sub_data_buff, sizeof(sub_data_buff))) > 0) {
+    data.insert(data.end(), sub_data_buff, sub_data_buff + bytesRead);
+  }
+  gzclose(fp);
+  return true;
+}
+
+// Publish the code (or phase) biases of a local Bias-SINEX file
+bool WebDataRequestor::LoadBiasFile(const std::string &path, bool phase) {
+  std::vector<char> data;
+  if (!ReadGzFile(path, data) || data.empty()) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: read bias file "
+              << path << " fail! caused by missing or empty file" << std::endl;
+    return false;
+  }
+  auto bias_data =
+      ParseBiasFromBuff(data, phase ? "__ESTIMATED_VALUE____" : "VALUE____");
+  if (!bias_data.has_value()) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: parse bias file "
+              << path << " fail! caused by unknown format" << std::endl;
+    return false;
+  }
+  store_->Update([&](CorrectionSnapshot &corr) {
+    (phase ? corr.phase_bias : corr.code_bias) = bias_data.value();
+  });
+  return true;
+}
+
 // Establish connection to CODE bias url and write the data to buffer
 bool WebDataRequestor::RequestCodeBias() {
   int year = vntimefunc::GetCurrentYear();
@@ -341,20 +384,12 @@ bool WebDataRequestor::RequestCodeBias() {
             << std::endl;
     return false;
   }
-  gzFile fp = gzopen(data_path.c_str(), "rb");
-  if (fp == nullptr) {
+  std::vector<char> data;
+  if (!ReadGzFile(data_path, data)) {
     log_web << vntimefunc::GetLocalTimeString() << "file not exist"
             << std::endl;
     return false;
   }
-  std::vector<char> data;
-  const int bufferSize = 4096;
-  char sub_data_buff[bufferSize];
-  int bytesRead;
-  while ((bytesRead = gzread(fp, sub_data_buff, sizeof(sub_data_buff))) > 0) {
-    data.insert(data.end(), sub_data_buff, sub_data_buff + bytesRead);
-  }
-  gzclose(fp);
 
   int n = remove(data_path.c_str());
   if (n == -1) {
@@ -370,8 +405,9 @@ bool WebDataRequestor::RequestCodeBias() {
   }
   auto code_bias_data = ParseBiasFromBuff(data, "VALUE____");
   if (code_bias_data.has_value()) {
-    std::lock_guard<std::mutex> lock(code_mutex);
-    code_bias = code_bias_data.value();
+    store_->Update([&](CorrectionSnapshot &corr) {
+      corr.code_bias = code_bias_data.value();
+    });
   } else {
     log_web << vntimefunc::GetLocalTimeString() << "Parse code bias failure"
             << std::endl;
@@ -429,20 +465,12 @@ bool WebDataRequestor::RequestPhaseBias() {
             << std::endl;
     return false;
   }
-  gzFile fp = gzopen(data_path.c_str(), "rb");
-  if (fp == nullptr) {
+  std::vector<char> data;
+  if (!ReadGzFile(data_path, data)) {
     log_web << vntimefunc::GetLocalTimeString() << "file not exist"
             << std::endl;
     return false;
   }
-  std::vector<char> data;
-  const int bufferSize = 4096;
-  char sub_data_buff[bufferSize];
-  int bytesRead;
-  while ((bytesRead = gzread(fp, sub_data_buff, sizeof(sub_data_buff))) > 0) {
-    data.insert(data.end(), sub_data_buff, sub_data_buff + bytesRead);
-  }
-  gzclose(fp);
 
   int n = remove(data_path.c_str());
   if (n == -1) {
@@ -458,8 +486,9 @@ bool WebDataRequestor::RequestPhaseBias() {
   }
   auto phase_bias_data = ParseBiasFromBuff(data, "__ESTIMATED_VALUE____");
   if (phase_bias_data.has_value()) {
-    std::lock_guard<std::mutex> lock(phase_mutex);
-    phase_bias = phase_bias_data.value();
+    store_->Update([&](CorrectionSnapshot &corr) {
+      corr.phase_bias = phase_bias_data.value();
+    });
   } else {
     log_web << vntimefunc::GetLocalTimeString() << "Parse phase bias failure"
             << std::endl;
@@ -545,22 +574,6 @@ void WebDataRequestor::RequestWebData() {
   pthread_exit(nullptr);
 }
 
-// Return the lastest USTEC data
-UsTecCorrData WebDataRequestor::get_ustec_data() {
-  std::lock_guard<std::mutex> lock(ustec_mutex);
-  return ustec_data;
-}
-
-BiasCorrData WebDataRequestor::get_code_bias() {
-  std::lock_guard<std::mutex> lock(code_mutex);
-  return code_bias;
-}
-
-BiasCorrData WebDataRequestor::get_phase_bias() {
-  std::lock_guard<std::mutex> lock(phase_mutex);
-  return phase_bias;
-}
-
 // start data request
 void WebDataRequestor::StartRequest() {
   //  while (!update_stream())
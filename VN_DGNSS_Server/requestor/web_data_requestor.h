@@ -5,11 +5,14 @@
 #include <curl/curl.h>
 #include <zlib.h>
 
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <mutex>
 #include <optional>
 #include <sstream>
+#include <type_traits>
+#include <vector>
 
 #include "rtklib.h"
 #include "time_common_func.h"
@@ -42,9 +45,23 @@ struct FtpFile {
   FILE *fp;
 };
 
+// USTEC grid: the first row holds the longitudes, each next row a latitude
+// followed by the TEC values
 struct UsTecCorrData {
+  // Max values kept per row, the grid has 102
+  static constexpr int kMaxCol = 128;
   double time[6]{};
-  std::vector<std::vector<int>> data;
+  int num_rows{};
+  int row_len[kUsTecNumRow]{};
+  int grid[kUsTecNumRow][kMaxCol]{};
+  // Rows as expected by UsTecIonoCorrComputer
+  std::vector<std::vector<int>> Rows() const {
+    std::vector<std::vector<int>> rows(num_rows);
+    for (int i = 0; i < num_rows; i++) {
+      rows[i].assign(grid[i], grid[i] + row_len[i]);
+    }
+    return rows;
+  }
 };
 
 struct SatBias {
@@ -53,37 +70,26 @@ struct SatBias {
   double value;
 };
 
+// Daily hardware biases, fixed-size per constellation and indexed by PRN
 struct BiasCorrData {
-  std::vector<SatBias> bias_GPS[MAX_VN_CODE_GPS];
-  std::vector<SatBias> bias_GAL[MAX_VN_CODE_GAL];
-  std::vector<SatBias> bias_BDS[MAX_VN_CODE_BDS];
+  std::array<SatBias, MAXPRNGPS + 1> bias_GPS[MAX_VN_CODE_GPS];
+  std::array<SatBias, MAXPRNGAL + 1> bias_GAL[MAX_VN_CODE_GAL];
+  std::array<SatBias, MAXPRNCMP + 1> bias_BDS[MAX_VN_CODE_BDS];
   BiasCorrData() {
-    for (auto &i : bias_GPS) {
-      i.resize(MAXPRNGPS + 1);
-      for (int j = 0; j < MAXPRNGPS + 1; j++) {
-        i[j].prn = -1;
-      }
-    }
-    for (auto &i : bias_GAL) {
-      i.resize(MAXPRNGAL + 1);
-      for (int j = 0; j < MAXPRNGAL + 1; j++) {
-        i[j].prn = -1;
-      }
-    }
-    for (auto &i : bias_BDS) {
-      i.resize(MAXPRNCMP + 1);
-      for (int j = 0; j < MAXPRNCMP + 1; j++) {
-        i[j].prn = -1;
-      }
-    }
+    for (auto &i : bias_GPS) i.fill({-1, 0.0});
+    for (auto &i : bias_GAL) i.fill({-1, 0.0});
+    for (auto &i : bias_BDS) i.fill({-1, 0.0});
   }
 };
+static_assert(std::is_trivially_copyable<BiasCorrData>::value,
+              "BiasCorrData must be trivially copyable");
+
+class CorrectionStore;
 
 class WebDataRequestor {
  private:
-  std::mutex ustec_mutex;
-  std::mutex code_mutex;
-  std::mutex phase_mutex;
+  // Corrections are published here, see correction_snapshot.h
+  CorrectionStore *store_;
 
   // Log for WEB data (Hardware biases, USTEC) record
   std::ofstream log_web;
@@ -100,8 +106,6 @@ class WebDataRequestor {
   // file name of phase bias
   std::string phase_bias_fname{};
   pthread_t pid{};
-  UsTecCorrData ustec_data;
-  BiasCorrData code_bias, phase_bias;
   bool done;
   static size_t WriteToBuffer(void *ptr, size_t size, size_t nmemb,
                                 void *userdata);
@@ -120,6 +124,7 @@ class WebDataRequestor {
                               BiasCorrData &cbias);
   static std::optional<BiasCorrData> ParseBiasFromBuff(
       const std::vector<char> &buffer, const std::string &val_title);
+  static bool ReadGzFile(const std::string &path, std::vector<char> &data);
   bool RequestCodeBias();
   bool RequestPhaseBias();
   static void *RequestWebWrapper(void *arg);
@@ -130,8 +135,8 @@ class WebDataRequestor {
   // No default constructor
   WebDataRequestor() = delete;
   // constructor
-  WebDataRequestor(std::string log_file_path)
-      : file_path_(std::move(log_file_path)) {}
+  WebDataRequestor(std::string log_file_path, CorrectionStore *store)
+      : store_(store), file_path_(std::move(log_file_path)) {}
   ~WebDataRequestor() { log_web.close(); }
   // Non-copyable
   WebDataRequestor(const WebDataRequestor &) = delete;
@@ -140,12 +145,10 @@ class WebDataRequestor {
   WebDataRequestor(WebDataRequestor &&) = delete;
   WebDataRequestor &operator=(WebDataRequestor &&) = delete;
 
-  UsTecCorrData get_ustec_data();
-  BiasCorrData get_code_bias();
-  BiasCorrData get_phase_bias();
-
   void StartRequest();
   void EndRequest();
+  // Replay: publish the biases of a local Bias-SINEX file (.BIA or .BIA.gz)
+  bool LoadBiasFile(const std::string &path, bool phase);
 };
 
 #endif// VN_DGNSS_SERVER_WEB_DATA_REQUESTOR_H
@@ -0,0 +1,323 @@
+// Decoding of synthetic RTCM 3 SSR frames (1057, 1060, 1063, 1264, 1265),
+// encoded bit by bit from the message layouts of RTCM 10403.3, through
+// RtcmSsrDecoder::Input. Checks the decoded values and that the blocks span
+// the messages sent with the multiple message indicator set.
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "rtcm_ssr_decoder.h"
+
+static int num_failures = 0;
+
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": " #cond " fail!"   \
+                << std::endl;                                           \
+      num_failures++;                                                   \
+    }                                                                   \
+  } while (0)
+
+static bool Near(double a, double b) { return fabs(a - b) < 1E-9; }
+
+// RTCM 3 frame written as the rtklib encoders, message from bit 24
+class FrameWriter {
+ public:
+  explicit FrameWriter(int type) { U(12, type); }
+  void U(int bits, uint32_t data) {
+    setbitu(buff_, pos_, bits, data);
+    pos_ += bits;
+  }
+  void S(int bits, int32_t data) {
+    setbits(buff_, pos_, bits, data);
+    pos_ += bits;
+  }
+  // SSR header, epoch: GPS time of week or GLONASS time of day (s)
+  void Header(int epoch, bool glonass, bool more, bool orbit, bool phase,
+              int nsat_bits, int nsat) {
+    U(glonass ? 17 : 20, epoch);
+    U(4, 2);  // Update interval 5 s
+    U(1, more ? 1 : 0);
+    if (orbit) U(1, 0);  // ITRF
+    U(4, 3);             // IOD SSR
+    U(16, 258);          // Provider id
+    U(4, 1);             // Solution id
+    if (phase) U(2, 3);  // Dispersive bias and MW consistency
+    U(nsat_bits, nsat);
+  }
+  // Preamble, length and CRC around the message
+  void Send(RtcmSsrDecoder &decoder, SsrTextParser::Handler &handler) {
+    int len = (pos_ - 24 + 7) / 8;
+    setbitu(buff_, 0, 8, Rtcm3Framer::kPreamble);
+    setbitu(buff_, 8, 6, 0);
+    setbitu(buff_, 14, 10, len);
+    setbitu(buff_, (3 + len) * 8, 24, rtk_crc24q(buff_, 3 + len));
+    decoder.Input(buff_, 3 + len + 3, handler);
+  }
+
+ private:
+  uint8_t buff_[Rtcm3Framer::kMaxFrame]{};
+  int pos_{24};
+};
+
+// Records the Handler calls
+class Recorder : public SsrTextParser::Handler {
+ public:
+  struct Event {
+    char what;  // 'B'egin, 'R'ecord, 'L'ayer, 'E'nd
+    SsrBlockType type;
+    gtime_t time;
+  };
+  std::vector<Event> events;
+  std::vector<SsrSatRecord> records;
+  std::vector<SsrVtecLayer> layers;
+
+  bool OnBlockBegin(const SsrBlockHeader &header) override {
+    events.push_back({'B', header.type, header.time});
+    return true;
+  }
+  void OnSatRecord(const SsrBlockHeader &header,
+                   const SsrSatRecord &record) override {
+    events.push_back({'R', header.type, header.time});
+    records.push_back(record);
+  }
+  void OnVtecLayer(const SsrBlockHeader &header,
+                   const SsrVtecLayer &layer) override {
+    events.push_back({'L', header.type, header.time});
+    layers.push_back(layer);
+  }
+  void OnBlockEnd(const SsrBlockHeader &header) override {
+    events.push_back({'E', header.type, header.time});
+  }
+  // Event letters, e.g. "BRRE"
+  std::string Sequence() const {
+    std::string seq;
+    for (const auto &e : events) seq += e.what;
+    return seq;
+  }
+  void Clear() {
+    events.clear();
+    records.clear();
+    layers.clear();
+  }
+};
+
+static const gtime_t kTime = gpst2time(2200, 345600.0);
+
+// GPS orbit record: IODE, radial/along/cross (0.1/0.4/0.4 mm) and rates
+// (0.001/0.004/0.004 mm/s)
+static void GpsOrbit(FrameWriter &f, int prn, int iode) {
+  f.U(6, prn);
+  f.U(8, iode);
+  f.S(22, 1234);
+  f.S(20, -250);
+  f.S(20, 100);
+  f.S(21, -500);
+  f.S(19, 250);
+  f.S(19, -25);
+}
+
+// Clock polynomial (0.1 mm, 0.001 mm/s, 0.00002 mm/s^2)
+static void Clock(FrameWriter &f) {
+  f.S(22, -3000);
+  f.S(21, 200);
+  f.S(27, 50);
+}
+
+static void CheckGpsOrbit(const SsrSatRecord &rec, int prn, int iode) {
+  CHECK(rec.sys == 'G' && rec.prn == prn && rec.iod == iode);
+  CHECK(Near(rec.values[0], 0.1234) && Near(rec.values[1], -0.1) &&
+        Near(rec.values[2], 0.04));
+  CHECK(Near(rec.values[3], -0.0005) && Near(rec.values[4], 0.001) &&
+        Near(rec.values[5], -0.0001));
+}
+
+// 1057 epoch split over two messages, then a single message epoch
+static void TestOrbitMultipleMessage() {
+  RtcmSsrDecoder decoder("SSRA00WHU0");
+  decoder.SetTime(kTime);
+  Recorder rec;
+  FrameWriter first(1057);
+  first.Header(345630, false, true, true, false, 6, 2);
+  GpsOrbit(first, 1, 45);
+  GpsOrbit(first, 2, 46);
+  first.Send(decoder, rec);
+  // Open until the last message of the epoch
+  CHECK(rec.Sequence() == "BRR");
+  FrameWriter last(1057);
+  last.Header(345630, false, false, true, false, 6, 1);
+  GpsOrbit(last, 3, 47);
+  last.Send(decoder, rec);
+  CHECK(rec.Sequence() == "BRRRE");
+  CHECK(rec.events[0].type == SsrBlockType::kOrbit);
+  CHECK(Near(timediff(rec.events[0].time, kTime), 30.0));
+  CHECK(rec.records.size() == 3);
+  for (size_t k = 0; k < rec.records.size(); k++) {
+    CheckGpsOrbit(rec.records[k], (int)k + 1, 45 + (int)k);
+  }
+
+  // A new epoch ends the block left open by the previous one
+  rec.Clear();
+  FrameWriter open(1057);
+  open.Header(345635, false, true, true, false, 6, 1);
+  GpsOrbit(open, 4, 48);
+  open.Send(decoder, rec);
+  FrameWriter next(1057);
+  next.Header(345640, false, false, true, false, 6, 1);
+  GpsOrbit(next, 5, 49);
+  next.Send(decoder, rec);
+  CHECK(rec.Sequence() == "BREBRE");
+  CHECK(Near(timediff(rec.events[2].time, kTime), 35.0));
+  CHECK(Near(timediff(rec.events[3].time, kTime), 40.0));
+}
+
+// 1060 combined orbit and clock split over two messages
+static void TestCombinedMultipleMessage() {
+  RtcmSsrDecoder decoder("SSRA00WHU0");
+  decoder.SetTime(kTime);
+  Recorder rec;
+  for (int part = 0; part < 2; part++) {
+    FrameWriter f(1060);
+    f.Header(345630, false, part == 0, true, false, 6, 1);
+    GpsOrbit(f, 10 + part, 50);
+    Clock(f);
+    f.Send(decoder, rec);
+  }
+  CHECK(rec.Sequence() == "BRBRRREE");
+  CHECK(rec.events[0].type == SsrBlockType::kOrbit);
+  CHECK(rec.events[2].type == SsrBlockType::kClock);
+  CHECK(rec.events[6].type == SsrBlockType::kOrbit);
+  CHECK(rec.events[7].type == SsrBlockType::kClock);
+  CHECK(rec.records.size() == 4);
+  if (rec.records.size() == 4) {
+    CheckGpsOrbit(rec.records[0], 10, 50);
+    const SsrSatRecord &clk = rec.records[1];
+    // Clock of the orbit IODE
+    CHECK(clk.sys == 'G' && clk.prn == 10 && clk.iod == 50);
+    CHECK(Near(clk.values[0], -0.3) && Near(clk.values[1], 0.0002) &&
+          Near(clk.values[2], 1E-6));
+    CheckGpsOrbit(rec.records[2], 11, 50);
+  }
+}
+
+// 1063 GLONASS orbit, epoch in GLONASS time of day
+static void TestGlonassOrbit() {
+  RtcmSsrDecoder decoder("SSRA00WHU0");
+  decoder.SetTime(kTime);
+  Recorder rec;
+  int week;
+  double tod =
+      fmod(time2gpst(timeadd(gpst2utc(kTime), 10800.0), &week), 86400.0);
+  FrameWriter f(1063);
+  f.Header((int)tod + 30, true, false, true, false, 6, 1);
+  f.U(5, 7);
+  f.U(8, 33);
+  f.S(22, 1234);
+  f.S(20, -250);
+  f.S(20, 100);
+  f.S(21, -500);
+  f.S(19, 250);
+  f.S(19, -25);
+  f.Send(decoder, rec);
+  CHECK(rec.Sequence() == "BRE");
+  CHECK(!rec.events.empty() &&
+        Near(timediff(rec.events[0].time, kTime), 30.0));
+  CHECK(rec.records.size() == 1);
+  if (!rec.records.empty()) {
+    const SsrSatRecord &obt = rec.records[0];
+    CHECK(obt.sys == 'R' && obt.prn == 7 && obt.iod == 33);
+    CHECK(Near(obt.values[0], 0.1234) && Near(obt.values[5], -0.0001));
+  }
+}
+
+// 1265 GPS phase bias
+static void TestPhaseBias() {
+  RtcmSsrDecoder decoder("SSRA00CNE0");
+  decoder.SetTime(kTime);
+  Recorder rec;
+  FrameWriter f(1265);
+  f.Header(345630, false, false, false, true, 6, 1);
+  f.U(6, 5);
+  f.U(5, 2);
+  f.U(9, 128);  // Yaw angle 1/256 semicircle
+  f.S(8, -16);  // Yaw rate 1/8192 semicircle/s
+  // Mode, integer, wide lane, discontinuity, bias (0.1 mm)
+  f.U(5, 0);
+  f.U(1, 1);
+  f.U(2, 2);
+  f.U(4, 0);
+  f.S(20, 1234);
+  f.U(5, 8);
+  f.U(1, 1);
+  f.U(2, 1);
+  f.U(4, 3);
+  f.S(20, -20000);
+  f.Send(decoder, rec);
+  CHECK(rec.Sequence() == "BRE");
+  CHECK(rec.records.size() == 1);
+  if (!rec.records.empty()) {
+    const SsrSatRecord &pb = rec.records[0];
+    CHECK(pb.sys == 'G' && pb.prn == 5 && pb.num_bias == 2);
+    CHECK(Near(pb.yaw_deg, 90.0) && Near(pb.yaw_rate, -16 / 8192.0 * 180.0));
+    CHECK(pb.bias[0].code == "1C" && Near(pb.bias[0].value, 0.1234));
+    CHECK(pb.bias[1].code == "2L" && Near(pb.bias[1].value, -2.0));
+  }
+}
+
+// 1264 VTEC, one layer of degree 2 and order 1
+static void TestVtec() {
+  RtcmSsrDecoder decoder("SSRA00CNE0");
+  decoder.SetTime(kTime);
+  Recorder rec;
+  const int deg = 2, ord = 1;
+  FrameWriter f(1264);
+  f.U(20, 345630);
+  f.U(4, 2);
+  f.U(1, 0);
+  f.U(4, 3);
+  f.U(16, 258);
+  f.U(4, 1);
+  f.U(9, 10);  // Quality
+  f.U(2, 0);   // 1 layer
+  f.U(8, 45);  // Height 10 km
+  f.U(4, deg - 1);
+  f.U(4, ord - 1);
+  // Cosine then sine terms, value 100 * degree + 10 * order + 1
+  for (int o = 0; o <= ord; o++) {
+    for (int d = o; d <= deg; d++) f.S(16, 100 * d + 10 * o + 1);
+  }
+  for (int o = 1; o <= ord; o++) {
+    for (int d = o; d <= deg; d++) f.S(16, -(100 * d + 10 * o + 1));
+  }
+  f.Send(decoder, rec);
+  CHECK(rec.Sequence() == "BLE");
+  CHECK(rec.layers.size() == 1);
+  if (!rec.layers.empty()) {
+    const SsrVtecLayer &layer = rec.layers[0];
+    CHECK(layer.num_deg == deg && layer.num_ord == ord);
+    CHECK(Near(layer.height_m, 450000.0));
+    for (int o = 0; o <= ord; o++) {
+      for (int d = o; d <= deg; d++) {
+        double value = (100 * d + 10 * o + 1) * 0.005;
+        CHECK(Near(layer.cos_coeffs[d * (ord + 1) + o], value));
+        if (o > 0) CHECK(Near(layer.sin_coeffs[d * (ord + 1) + o], -value));
+      }
+    }
+  }
+}
+
+int main() {
+  TestOrbitMultipleMessage();
+  TestCombinedMultipleMessage();
+  TestGlonassOrbit();
+  TestPhaseBias();
+  TestVtec();
+  if (num_failures > 0) {
+    std::cerr << num_failures << " checks fail!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "all checks passed" << std::endl;
+  return 0;
+}
@@ -199,6 +199,26 @@ extern double code2freq(int sys, uint8_t code, int fcn)
   return freq;
 }
 
+/* extract unsigned/signed bits ------------------------------------------------
+* extract unsigned/signed bits from byte data
+* args   : unsigned char *buff I byte data
+*          int    pos    I      bit position from start of data (bits)
+*          int    len    I      bit length (bits) (len<=32)
+* return : extracted unsigned/signed bits
+*-----------------------------------------------------------------------------*/
+extern uint32_t getbitu(const uint8_t *buff, int pos, int len)
+{
+    uint32_t bits=0;
+    int i;
+    for (i=pos;i<pos+len;i++) bits=(bits<<1)+((buff[i/8]>>(7-i%8))&1u);
+    return bits;
+}
+extern int32_t getbits(const uint8_t *buff, int pos, int len)
+{
+    uint32_t bits=getbitu(buff,pos,len);
+    if (len<=0||32<=len||!(bits&(1u<<(len-1)))) return (int32_t)bits;
+    return (int32_t)(bits|(~0u<<len)); /* extend sign */
+}
 /* set unsigned/signed bits ----------------------------------------------------
 * set unsigned/signed bits to byte data
 * args   : unsigned char *buff IO byte data
@@ -708,8 +708,7 @@ static int encode_msm_lock(rtcm_t *rtcm, int i, const double *lock, int ncell)
   int j,lock_val;
 
   for (j=0;j<ncell;j++) {
-    //lock_val=to_msm_lock(lock[j]);
-    lock_val = 0; // Lock time max
+    lock_val=to_msm_lock(lock[j]);
     setbitu(rtcm->buff,i,4,lock_val); i+=4;
   }
   return i;
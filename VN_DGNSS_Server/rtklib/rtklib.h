@@ -803,6 +803,8 @@ EXPORT int  geterp (const erp_t *erp, gtime_t time, double *val);
 /* positioning models --------------------------------------------------------*/
 EXPORT double satwavelen(int sat, int frq, const nav_t *nav);
 /* receiver raw data functions -----------------------------------------------*/
+EXPORT uint32_t getbitu(const uint8_t *buff, int pos, int len);
+EXPORT int32_t  getbits(const uint8_t *buff, int pos, int len);
 EXPORT void setbitu(uint8_t *buff, int pos, int len, uint32_t data);
 EXPORT void setbits(uint8_t *buff, int pos, int len, int32_t data);
 EXPORT uint32_t rtk_crc24q (const uint8_t *buff, int len);
@@ -1,15 +1,14 @@
 #include "server.h"
 
-int main(int argc, char *argv[]) {
-  // check user input port
-  if (argc < 3) {
-    std::cerr << "eg: ./server IP Port" << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  char const *IPaddr = argv[1];            // user input server IP
-  uint16_t const port_nu = std::stoi(argv[2]);  // user input server port number
-  std::ofstream serverlog;
-  serverlog.open("../Log/serverlog.txt",std::ios::app); // open file by append
+// Set by SIGINT/SIGTERM in the supervisor
+static volatile sig_atomic_t stop_requested = 0;
+
+static void OnStopSignal(int) { stop_requested = 1; }
+
+// Create the listening socket, exit on failure. With reuse_port every worker
+// process binds its own socket and the kernel balances the connections.
+static int CreateListenSocket(char const *IPaddr, uint16_t port_nu,
+                              bool reuse_port) {
   // 1.create a socket
   int socket_fd = socket(AF_INET, SOCK_STREAM, 0);
   if (socket_fd == -1) {
@@ -25,6 +24,12 @@ int main(int argc, char *argv[]) {
               << strerror(errno) << std::endl;
     exit(EXIT_FAILURE);
   }
+  if (reuse_port && setsockopt(socket_fd, SOL_SOCKET, SO_REUSEPORT, &bReuse,
+                               sizeof(bReuse)) == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: set socket REUSEPORT fail! caused by "
+              << strerror(errno) << std::endl;
+    exit(EXIT_FAILURE);
+  }
   //  bool noLinger = false;
   //  setsockopt(socket_fd,SOL_SOCKET,SO_DONTLINGER,(const
   //  char*)&noLinger,sizeof(bool));
@@ -54,99 +59,283 @@ int main(int argc, char *argv[]) {
   }
 
   // 3.listen
-  int listen_ret = listen(socket_fd, MAX_NUM_OF_CLIENTS);
+  int listen_ret = listen(socket_fd, LISTEN_BACKLOG);
   if (listen_ret == -1) {
     std::cerr << vntimefunc::GetLocalTimeString() << "err: listen fail! caused by " << strerror(errno)
               << std::endl;
     exit(EXIT_FAILURE);
   }
+  return socket_fd;
+}
 
-  serverlog << vntimefunc::GetLocalTimeString() << "The server started..." << std::endl;
-  serverlog << vntimefunc::GetLocalTimeString() << "Listen on port: " << port_nu << std::endl;
-  serverlog << vntimefunc::GetLocalTimeString() << "Waiting for client..." << std::endl;
+// Get empirical Trop model data and the geoid model, exit on failure
+static IggtropExperimentModel LoadModels() {
+  IggtropExperimentModel TropData = GetIggtropCorrDataFromFile(TROP_MODEL_PATH);
+  if (!TropData.IsLoaded()) {
+    std::cerr << vntimefunc::GetLocalTimeString()
+              << "err: load Trop model fail!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  if (!GeoidModelHelper::LoadModel(GEOID_MODEL_PATH)) {
+    std::cerr << vntimefunc::GetLocalTimeString()
+              << "err: load geoid model fail!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  return TropData;
+}
 
-  // 4.Start requestor
-  BkgDataRequestor *foo_bkg;
-  WebDataRequestor *foo_web;
+// Start the requestors publishing into corr_store and wait for the first
+// corrections. The BKG streams are recorded to capture_path if not null.
+static void StartRequestors(CorrectionStore *corr_store,
+                            BkgSource bkg_source, const char *capture_path,
+                            BkgDataRequestor **foo_bkg,
+                            WebDataRequestor **foo_web) {
   std::string FOLDER_PATH = "../Log/";  // Specify the path of correction data
-  foo_bkg = new BkgDataRequestor(FOLDER_PATH);
-  foo_web = new WebDataRequestor(FOLDER_PATH);
+  *foo_bkg = new BkgDataRequestor(FOLDER_PATH, corr_store, bkg_source);
+  *foo_web = new WebDataRequestor(FOLDER_PATH, corr_store);
+  static StreamCaptureWriter capture;
+  if (capture_path != nullptr && capture.Open(capture_path)) {
+    (*foo_bkg)->SetCapture(&capture);
+  }
   // start requesting data
-  foo_bkg->StartRequestor();
-  foo_web->StartRequest();
-  while (!(foo_web->ready && foo_bkg->ssr_ready && foo_bkg->eph_ready)) {
+  (*foo_bkg)->StartRequestor();
+  (*foo_web)->StartRequest();
+  while (!((*foo_web)->ready && (*foo_bkg)->ssr_ready &&
+           (*foo_bkg)->eph_ready)) {
     sleep(2);
   }
-  // Get empirical Trop model data
-  IggtropExperimentModel TropData = GetIggtropCorrDataFromFile("../vn_dgnss_source/IGGtropSHexpModel.ztd");
-  // 5.wait and connect, pthread_create
-  unsigned i;
-  SockInfo client_info[MAX_NUM_OF_CLIENTS];  // maximum number of threads
-  // set fd=-1
-  for (i = 0; i < sizeof(client_info) / sizeof(client_info[0]); ++i) {
-    client_info[i].client_sock.fd = -1;
-  }
-  socklen_t len = sizeof(struct sockaddr_in);
-  std::ofstream rtcmlog;
-  rtcmlog.open("../../../Log/rtcm_log.txt");
+}
+
+// Serve the clients of socket_fd from num_loops event loops until they exit,
+// logging to log_sink. The metrics are served on 127.0.0.1:metrics_port if
+// not 0.
+static void Serve(int socket_fd, int log_sink,
+                  const CorrectionStore *corr_store, int num_loops,
+                  uint16_t metrics_port) {
+  IggtropExperimentModel TropData = LoadModels();
+  VrsCellCache vrs_cache(VRS_CELL_SIZE_DEG, VRS_CELL_HEIGHT_M);
+  // As many compute threads as event loops, one per core of the process
+  EpollServer server(socket_fd, corr_store, &TropData, &vrs_cache, log_sink,
+                     num_loops, num_loops, MAX_NUM_OF_CLIENTS);
+  if (!server.Start()) {
+    std::cerr << vntimefunc::GetLocalTimeString()
+              << "err: start event loops fail!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  MetricsServer metrics(corr_store, &server, &vrs_cache);
+  if (metrics_port != 0 && metrics.Start(metrics_port)) {
+    vnlog::ThreadStream(log_sink) << vntimefunc::GetLocalTimeString()
+                                  << "Metrics on port: " << metrics_port
+                                  << std::endl;
+  }
+  server.Wait();
+}
+
+// Ingest process: the requestors write the corrections into the bus
+static int RunIngest(const std::string &bus_name, BkgSource bkg_source,
+                     const char *capture_path) {
+  CorrectionBus bus;
+  if (!bus.Open(bus_name, true)) return EXIT_FAILURE;
+  // Continues from the corrections of a previous ingest process, if any
+  CorrectionStore corr_store(bus.Rings());
+  BkgDataRequestor *foo_bkg;
+  WebDataRequestor *foo_web;
+  StartRequestors(&corr_store, bkg_source, capture_path, &foo_bkg, &foo_web);
+  bus.SetReady();
   while (true) {
-    for (i = 0; i < MAX_NUM_OF_CLIENTS; i++) {
-      if (client_info[i].client_sock.fd == -1) break;
+    pause();
+  }
+}
+
+// Worker process: serves its share of the clients from the bus
+static int RunWorker(const std::string &bus_name, char const *IPaddr,
+                     uint16_t port_nu, int num_loops, uint16_t metrics_port) {
+  // The worker and its event loops log through the asynchronous writer
+  int log_sink = vnlog::OpenSink(SERVER_LOG_PATH, true);
+  if (log_sink == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: open "
+              << SERVER_LOG_PATH << " fail!" << std::endl;
+    return EXIT_FAILURE;
+  }
+  CorrectionBus bus;
+  if (!bus.Open(bus_name, false)) return EXIT_FAILURE;
+  while (!bus.IsReady()) {
+    sleep(2);
+  }
+  const CorrectionBus &reader = bus;
+  CorrectionStore corr_store(reader.Rings());
+  // Mirror the snapshot published by the ingest process, until the store
+  // and the bus are destroyed
+  std::atomic<bool> stop_sync{false};
+  std::thread sync([&corr_store, &stop_sync] {
+    while (!stop_sync.load(std::memory_order_relaxed)) {
+      corr_store.Sync();
+      usleep(BUS_SYNC_PERIOD_US);
     }
-    if (i >= MAX_NUM_OF_CLIENTS - 1) {
-      // Searching available site when clients reach maximum
-      bool wait = true;
-      while (wait) {
-        sleep(1);
-        for (int k = 0; k < MAX_NUM_OF_CLIENTS; k++) {
-          if (client_info[k].client_sock.fd == -1) {
-            i = k;
-            wait = false;
-            break;
-          }
-        }
-      }
+  });
+  int socket_fd = CreateListenSocket(IPaddr, port_nu, true);
+  vnlog::ThreadStream(log_sink) << vntimefunc::GetLocalTimeString()
+                                << "Worker " << getpid()
+                                << " listen on port: " << port_nu << std::endl;
+  Serve(socket_fd, log_sink, &corr_store, num_loops, metrics_port);
+  close(socket_fd);
+  stop_sync.store(true, std::memory_order_relaxed);
+  sync.join();
+  return 0;
+}
+
+// Fork a child process running fn, -1 on failure
+template <typename F>
+static pid_t Spawn(F &&fn) {
+  pid_t pid = fork();
+  if (pid == 0) {
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+    _exit(fn());
+  }
+  return pid;
+}
+
+// Supervisor: one ingest process and num_workers worker processes sharing
+// the corrections through a shared memory bus. A process that exits is
+// restarted, the others keep running. The supervisor has no thread, so it
+// can fork at any time. Worker i serves its metrics on metrics_port + i - 1.
+static int RunSupervisor(char const *IPaddr, uint16_t port_nu,
+                         BkgSource bkg_source, const char *capture_path,
+                         int num_workers, uint16_t metrics_port,
+                         std::ofstream &serverlog) {
+  std::string bus_name = CorrectionBus::SegmentName(port_nu);
+  CorrectionBus bus;
+  if (!bus.Create(bus_name)) exit(EXIT_FAILURE);
+  bus.Close();
+  struct sigaction sa {};
+  sa.sa_handler = OnStopSignal;
+  sigemptyset(&sa.sa_mask);
+  // No SA_RESTART, so waitpid returns when asked to stop
+  sigaction(SIGINT, &sa, nullptr);
+  sigaction(SIGTERM, &sa, nullptr);
+
+  int num_cores = (int)std::thread::hardware_concurrency();
+  int num_loops = std::max(1, num_cores / num_workers);
+  // Child 0 is the ingest process, the others the workers
+  auto spawn_child = [&](int i) {
+    if (i == 0) {
+      return Spawn(
+          [&] { return RunIngest(bus_name, bkg_source, capture_path); });
     }
+    uint16_t worker_metrics_port =
+        metrics_port == 0 ? 0 : (uint16_t)(metrics_port + i - 1);
+    return Spawn([&] {
+      return RunWorker(bus_name, IPaddr, port_nu, num_loops,
+                       worker_metrics_port);
+    });
+  };
+  std::vector<pid_t> pids(num_workers + 1, -1);
+  for (int i = 0; i <= num_workers; i++) {
+    pids[i] = spawn_child(i);
+  }
+  serverlog << vntimefunc::GetLocalTimeString() << "Started " << num_workers
+            << " workers on port: " << port_nu << std::endl;
+  while (!stop_requested) {
+    int status;
+    pid_t pid = waitpid(-1, &status, 0);
+    if (pid == -1) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    for (int i = 0; i <= num_workers; i++) {
+      if (pids[i] != pid) continue;
+      serverlog << vntimefunc::GetLocalTimeString()
+                << (i == 0 ? "Ingest " : "Worker ") << pid << " exited ("
+                << (WIFSIGNALED(status) ? WTERMSIG(status) : WEXITSTATUS(status))
+                << "), restart" << std::endl;
+      // Do not spin when a child cannot start
+      sleep(1);
+      if (!stop_requested) pids[i] = spawn_child(i);
+    }
+  }
+  for (pid_t pid : pids) {
+    if (pid > 0) kill(pid, SIGTERM);
+  }
+  while (waitpid(-1, nullptr, 0) > 0) {
+  }
+  CorrectionBus::Remove(bus_name);
+  serverlog << vntimefunc::GetLocalTimeString() << "The server stopped"
+            << std::endl;
+  return 0;
+}
 
-    // main thread: wait and connection
-    client_info[i].client_sock.fd = accept(
-        socket_fd, (struct sockaddr *)&client_info[i].client_sock.addr, &len);
-    if (client_info[i].client_sock.fd == -1) {
-      char client_ip[INET_ADDRSTRLEN];
-      inet_ntop(AF_INET, &(client_info[i].client_sock.addr.sin_addr), client_ip,
-                INET_ADDRSTRLEN);
-      serverlog << vntimefunc::GetLocalTimeString() << "Failure accepting Client IP: " << client_ip
-                << " Port: " << ntohs(client_info[i].client_sock.addr.sin_port)
-                << " caused by " << strerror(errno) << std::endl;
-      close(client_info[i].client_sock.fd);
-      continue;
+int main(int argc, char *argv[]) {
+  // check user input port
+  if (argc < 3) {
+    std::cerr << "eg: ./server IP Port [rtcm] [--workers N] [--capture FILE] "
+                 "[--metrics PORT]"
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  char const *IPaddr = argv[1];            // user input server IP
+  uint16_t const port_nu = std::stoi(argv[2]);  // user input server port number
+  // EPH/SSR from the raw RTCM 3 streams instead of the BNC text output
+  BkgSource bkg_source = BkgSource::kBncText;
+  // Worker processes, 0 to serve the clients from this process
+  int num_workers = 0;
+  // Record the BKG streams for VN_DGNSS_Replay
+  const char *capture_path = nullptr;
+  // Local port of the metrics endpoint, 0 for none
+  uint16_t metrics_port = 0;
+  for (int i = 3; i < argc; i++) {
+    if (strcmp(argv[i], "rtcm") == 0) {
+      bkg_source = BkgSource::kRtcm3;
+    } else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+      num_workers = std::max(0, atoi(argv[++i]));
+    } else if (strcmp(argv[i], "--capture") == 0 && i + 1 < argc) {
+      capture_path = argv[++i];
+    } else if (strcmp(argv[i], "--metrics") == 0 && i + 1 < argc) {
+      metrics_port = (uint16_t)atoi(argv[++i]);
     }
-    struct timeval timeout_recv = {1, 0};  // 1s
-    struct timeval timeout_send = {1, 0};  // 1s
-    // Set send timeout
-    setsockopt(client_info[i].client_sock.fd, SOL_SOCKET, SO_SNDTIMEO,
-               (const char *)&timeout_send, sizeof(timeout_send));
-    // Set recv timeout
-    setsockopt(client_info[i].client_sock.fd, SOL_SOCKET, SO_RCVTIMEO,
-               (const char *)&timeout_recv, sizeof(timeout_recv));
-    client_info[i].foo_bkg = foo_bkg;
-    client_info[i].foo_web = foo_web;
-    client_info[i].client_sock.log = &serverlog;
-    client_info[i].client_sock.rtcm_log = &rtcmlog;
-    client_info[i].TropData = TropData;
-    // Make Periodic for the client
-    timeperiodic::MakePeriodic(SEND_PERIOD, client_info[i].periodic);
-    // create pthread to transfer
-    pthread_create(&client_info[i].tid, nullptr, pth_handler, &client_info[i]);
-    // detach a thread
-    pthread_detach(client_info[i].tid);
   }
+  // 0.raise the open file limit, every client takes a socket and a timer
+  struct rlimit fd_limit {};
+  if (getrlimit(RLIMIT_NOFILE, &fd_limit) == 0) {
+    fd_limit.rlim_cur = fd_limit.rlim_max;
+    setrlimit(RLIMIT_NOFILE, &fd_limit);
+  }
+  if (num_workers > 0) {
+    // The supervisor has no thread, it writes the log file directly
+    std::ofstream serverlog;
+    serverlog.open(SERVER_LOG_PATH, std::ios::app);  // open file by append
+    return RunSupervisor(IPaddr, port_nu, bkg_source, capture_path,
+                         num_workers, metrics_port, serverlog);
+  }
+  // 1-3.create, bind and listen
+  int socket_fd = CreateListenSocket(IPaddr, port_nu, false);
+
+  // The requestor and event loop threads share the asynchronous log
+  int log_sink = vnlog::OpenSink(SERVER_LOG_PATH, true);
+  if (log_sink == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: open "
+              << SERVER_LOG_PATH << " fail!" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  std::ostream &serverlog = vnlog::ThreadStream(log_sink);
+  serverlog << vntimefunc::GetLocalTimeString() << "The server started..." << std::endl;
+  serverlog << vntimefunc::GetLocalTimeString() << "Listen on port: " << port_nu << std::endl;
+  serverlog << vntimefunc::GetLocalTimeString() << "Waiting for client..." << std::endl;
+
+  // 4.Start requestor
+  BkgDataRequestor *foo_bkg;
+  WebDataRequestor *foo_web;
+  // Corrections shared by all clients
+  CorrectionStore corr_store;
+  StartRequestors(&corr_store, bkg_source, capture_path, &foo_bkg, &foo_web);
+  // 5.serve clients from the event loops, one per core
+  int num_loops = (int)std::thread::hardware_concurrency();
+  Serve(socket_fd, log_sink, &corr_store, num_loops, metrics_port);
 
   // 6.close
   foo_bkg->EndRequestor();
   foo_web->EndRequest();
   close(socket_fd);
 
-  // terminate main thread
-  pthread_exit(nullptr);
+  return 0;
 }
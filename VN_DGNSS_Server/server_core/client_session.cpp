@@ -0,0 +1,59 @@
+#include "client_session.h"
+
+bool ParsePositionMessage(std::string const &message,
+                          std::vector<double> &position,
+                          GnssSystemInfo &infor, int &period_s)
+// An example position message, the epoch period (s) at the end is optional:
+// $POSECEF 1564964.4988 4889464.1566 156489.65464 01 01 01 [1] \r\n
+{
+  std::stringstream ss(message);
+  std::string tmp, sys_code;
+  ss >> tmp;
+  if (!ss.good() || tmp != POSITION_MSG_HEADER) return false;
+  std::vector<double> ret(3, 0);
+  for (int i = 0; i < 3; ++i) {
+    ss >> ret[i];
+  }
+  int disable = 0;
+  for (int i = 0; i < 3; ++i) {
+    int code;
+    ss >> code;
+    if (code > 0) {
+      infor.code_F1[i] = code;
+    } else if (code == 0) {
+      disable++;
+      infor.sys[i] = false;
+      infor.code_F1[i] = 0;
+    }
+  }
+  if (!ss.good() || disable >= 3) {
+    return false;
+  }
+  int period;
+  if (ss >> period) {
+    // The epochs of a period must align with the GPS minutes
+    if (period < 1 || period > MAX_SEND_PERIOD_S ||
+        MAX_SEND_PERIOD_S % period != 0) {
+      return false;
+    }
+    period_s = period;
+  }
+  infor.code_F2[0] = VN_CODE_GPS_C2L;
+  infor.code_F2[1] = VN_CODE_GAL_C7Q;
+  infor.code_F2[2] = VN_CODE_BDS_C7;
+  position = ret;
+  return true;
+}
+
+void UseServerPosition(ClientSession &session) {
+  session.pos_ecef[0] = -2455314.231;
+  session.pos_ecef[1] = -4691596.883;
+  session.pos_ecef[2] = 3543996.389;
+  session.infor.sys.assign(3, true);
+  session.infor.code_F1[0] = VN_CODE_GPS_C1C;
+  session.infor.code_F2[0] = VN_CODE_GPS_C2L;
+  session.infor.code_F1[1] = VN_CODE_GAL_C1C;
+  session.infor.code_F2[1] = VN_CODE_GAL_C7Q;
+  session.infor.code_F1[2] = VN_CODE_BDS_C2I;
+  session.infor.code_F2[2] = VN_CODE_BDS_C7;
+}
@@ -0,0 +1,67 @@
+#ifndef VN_DGNSS_SERVER_CLIENT_SESSION_H
+#define VN_DGNSS_SERVER_CLIENT_SESSION_H
+
+#pragma once
+#include <netinet/in.h>
+
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "async_log.h"
+#include "create_rtcm_msg.h"
+#include "epoch_generation_helper.h"
+#include "time_common_func.h"
+
+#define ONE_SEC_PERIOD 1000000  // 1s in microseconds, the unit of the periods
+#define SEND_PERIOD 5000000  // Default period of server send RTCM: 5s
+#define MAX_SEND_PERIOD_S 60  // Max period a client can ask for (s)
+#define BUFF_SIZE 1200       // client position buffer size
+#define POSITION_MSG_HEADER "$POSECEF"
+
+// State of one connected rover, owned by the event loop serving its socket
+struct ClientSession {
+  int fd{-1};
+  struct sockaddr_in addr {};
+  std::string ip;
+  uint16_t port{};
+  // Epoch period (s), the epochs are sent at the GPS seconds multiple of it
+  int period_s{SEND_PERIOD / ONE_SEC_PERIOD};
+  // UTC second of connection and of the next epoch
+  time_t connect_sec{};
+  time_t next_epoch{};
+  // An epoch of the client is being generated, see EpollServer::EpochJob
+  bool epoch_pending{};
+  // Client position (ECEF) and requested systems/codes
+  std::vector<double> pos_ecef = std::vector<double>(3, 0);
+  GnssSystemInfo infor;
+  bool pos_received{};
+  // Per-client log
+  std::string rst_path;
+  vnlog::LogStream rst;
+  int iter{};
+  // Partial $POSECEF messages not yet terminated
+  std::string in_buff;
+  // RTCM frames accepted for the socket but not yet written, shared with
+  // the other clients of the same epoch, one frame per epoch. out_offset is
+  // the number of bytes of the front frame already written. At most the
+  // partly written frame and the latest epoch are pending. stale_epochs
+  // counts the epochs in a row that replaced an unsent one.
+  std::deque<RtcmFramePtr> out_frames;
+  size_t out_offset{};
+  size_t out_bytes{};
+  int stale_epochs{};
+  bool want_write{};
+};
+
+// Parse a position message into a position vector, and the epoch period if
+// given. Returns true if parsing is successful.
+bool ParsePositionMessage(std::string const &message,
+                          std::vector<double> &position,
+                          GnssSystemInfo &infor, int &period_s);
+
+// Fall back to the server position and default codes
+void UseServerPosition(ClientSession &session);
+
+#endif  // VN_DGNSS_SERVER_CLIENT_SESSION_H
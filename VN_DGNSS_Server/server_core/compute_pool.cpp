@@ -0,0 +1,94 @@
+#include "compute_pool.h"
+
+ComputePool::ComputePool(int num_threads, int capacity)
+    : capacity_(capacity) {
+  if (num_threads < 1) num_threads = 1;
+  for (int i = 0; i < num_threads; i++) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  for (int i = 0; i < num_threads; i++) {
+    workers_[i]->thread = std::thread(&ComputePool::Run, this, i);
+  }
+}
+
+ComputePool::~ComputePool() { Stop(); }
+
+std::vector<ComputeTask *> ComputePool::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    stop_ = true;
+  }
+  idle_cv_.notify_all();
+  std::vector<ComputeTask *> unrun;
+  for (auto &worker : workers_) {
+    if (worker->thread.joinable()) worker->thread.join();
+  }
+  for (auto &worker : workers_) {
+    unrun.insert(unrun.end(), worker->tasks.begin(), worker->tasks.end());
+    worker->tasks.clear();
+  }
+  num_queued_ = 0;
+  return unrun;
+}
+
+bool ComputePool::Submit(ComputeTask *task) {
+  // The bound may be passed by the submitters racing here, it only limits
+  // the backlog
+  if (num_queued_.load() >= capacity_) return false;
+  Worker &worker = *workers_[next_.fetch_add(1, std::memory_order_relaxed) %
+                             workers_.size()];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(task);
+    num_queued_.fetch_add(1);
+  }
+  // Sequentially consistent with the waiter: either it sees the task or
+  // this sees it idle. Taking the lock orders the wake up after its check.
+  if (num_idle_.load() > 0) {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    idle_cv_.notify_one();
+  }
+  return true;
+}
+
+ComputeTask *ComputePool::Take(int index) {
+  {
+    Worker &own = *workers_[index];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.tasks.empty()) {
+      ComputeTask *task = own.tasks.back();
+      own.tasks.pop_back();
+      num_queued_.fetch_sub(1);
+      return task;
+    }
+  }
+  int n = (int)workers_.size();
+  for (int i = 1; i < n; i++) {
+    Worker &victim = *workers_[(index + i) % n];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      ComputeTask *task = victim.tasks.front();
+      victim.tasks.pop_front();
+      num_queued_.fetch_sub(1);
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+void ComputePool::Run(int index) {
+  while (true) {
+    ComputeTask *task = Take(index);
+    if (task != nullptr) {
+      task->Run();
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(idle_mutex_);
+    num_idle_.fetch_add(1);
+    idle_cv_.wait(lock, [&] {
+      return stop_ || num_queued_.load() > 0;
+    });
+    num_idle_.fetch_sub(1);
+    if (stop_) return;
+  }
+}
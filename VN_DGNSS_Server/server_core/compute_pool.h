@@ -0,0 +1,65 @@
+#ifndef VN_DGNSS_SERVER_COMPUTE_POOL_H
+#define VN_DGNSS_SERVER_COMPUTE_POOL_H
+
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Unit of work of the ComputePool, owned by the submitter
+class ComputeTask {
+ public:
+  virtual ~ComputeTask() = default;
+  virtual void Run() = 0;
+};
+
+// Bounded work-stealing thread pool. Every worker has its own queue, a
+// deque behind its own mutex: a task is a client epoch of a fraction of a
+// millisecond, the lock is not the cost. Tasks are spread over the queues
+// round robin, a worker takes the newest task of its queue and, when empty,
+// steals the oldest of another queue, so a burst submitted by one thread is
+// shared by all the workers.
+class ComputePool {
+ public:
+  // capacity: max tasks queued and not yet started
+  ComputePool(int num_threads, int capacity);
+  ~ComputePool();
+  // Non-copyable
+  ComputePool(const ComputePool &) = delete;
+  ComputePool &operator=(const ComputePool &) = delete;
+
+  // Queue a task, false when the pool is full (run it yourself)
+  bool Submit(ComputeTask *task);
+  // Join the threads, the tasks not started are handed back. Called by the
+  // destructor if not before.
+  std::vector<ComputeTask *> Stop();
+  int GetNumOfThreads() const { return (int)workers_.size(); }
+
+ private:
+  struct alignas(64) Worker {
+    std::mutex mutex;
+    std::deque<ComputeTask *> tasks;
+    std::thread thread;
+  };
+
+  const int capacity_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  // Tasks in the queues, changed under the lock of the queue with the push
+  // or pop, so an idle worker woken by it finds the task
+  std::atomic<int> num_queued_{0};
+  std::atomic<unsigned> next_{0};
+  // Idle workers wait here
+  std::mutex idle_mutex_;
+  std::condition_variable idle_cv_;
+  std::atomic<int> num_idle_{0};
+  bool stop_{};
+
+  void Run(int index);
+  ComputeTask *Take(int index);
+};
+
+#endif  // VN_DGNSS_SERVER_COMPUTE_POOL_H
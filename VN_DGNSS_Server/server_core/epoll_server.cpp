@@ -0,0 +1,563 @@
+#include "epoll_server.h"
+
+#include <fcntl.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+
+#include <cstring>
+#include <iomanip>
+
+#include "stage_metrics.h"
+
+EpollServer::EpollServer(int listen_fd, const CorrectionStore *store,
+                         const IggtropExperimentModel *trop,
+                         VrsCellCache *vrs_cache, int log_sink, int num_loops,
+                         int num_compute, int max_clients)
+    : listen_fd_(listen_fd),
+      store_(store),
+      trop_(trop),
+      vrs_cache_(vrs_cache),
+      log_sink_(log_sink),
+      max_clients_(max_clients) {
+  if (num_loops < 1) num_loops = 1;
+  for (int i = 0; i < num_loops; i++) {
+    loops_.push_back(std::make_unique<EventLoop>());
+    loops_.back()->server = this;
+  }
+  if (num_compute > 0) {
+    pool_ = std::make_unique<ComputePool>(num_compute, kMaxQueuedJobs);
+  }
+}
+
+EpollServer::~EpollServer() {
+  // Join the compute threads before the sessions of their jobs go away, the
+  // jobs not started and the ones done are freed with their loop
+  if (pool_) {
+    for (ComputeTask *task : pool_->Stop()) {
+      auto *job = static_cast<EpochJob *>(task);
+      job->loop->free_jobs.emplace_back(job);
+    }
+    pool_.reset();
+  }
+  for (auto &loop : loops_) {
+    ReclaimJobs(*loop);
+    for (auto &elem : loop->sessions) {
+      close(elem.second->fd);
+    }
+    for (int fd : loop->closed_fds) close(fd);
+    if (loop->tick_fd != -1) close(loop->tick_fd);
+    if (loop->done_fd != -1) close(loop->done_fd);
+    if (loop->epoll_fd != -1) close(loop->epoll_fd);
+  }
+}
+
+bool EpollServer::Start() {
+  int flags = fcntl(listen_fd_, F_GETFL, 0);
+  if (flags == -1 || fcntl(listen_fd_, F_SETFL, flags | O_NONBLOCK) == -1) {
+    Log() << vntimefunc::GetLocalTimeString()
+          << "err: set listen socket non-blocking fail! caused by "
+          << strerror(errno) << std::endl;
+    return false;
+  }
+  int started = 0;
+  for (auto &loop : loops_) {
+    loop->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (loop->epoll_fd == -1) continue;
+    // Every loop waits on the listen socket, the kernel wakes only one of
+    // them per incoming connection
+    struct epoll_event ev {};
+    ev.events = EPOLLIN | EPOLLEXCLUSIVE;
+    ev.data.fd = listen_fd_;
+    // One tick per UTC (and GPS) second boundary drives the timer wheel
+    loop->wheel_sec = time(nullptr);
+    loop->tick_fd =
+        timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    struct itimerspec tick {};
+    tick.it_value.tv_sec = loop->wheel_sec + 1;
+    tick.it_interval.tv_sec = 1;
+    struct epoll_event ev_tick {};
+    ev_tick.events = EPOLLIN;
+    ev_tick.data.fd = loop->tick_fd;
+    loop->done_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    struct epoll_event ev_done {};
+    ev_done.events = EPOLLIN;
+    ev_done.data.fd = loop->done_fd;
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, listen_fd_, &ev) == -1 ||
+        loop->tick_fd == -1 ||
+        timerfd_settime(loop->tick_fd, TFD_TIMER_ABSTIME, &tick, nullptr) ==
+            -1 ||
+        epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->tick_fd, &ev_tick) ==
+            -1 ||
+        loop->done_fd == -1 ||
+        epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, loop->done_fd, &ev_done) ==
+            -1 ||
+        pthread_create(&loop->tid, nullptr, EventLoopWrapper, loop.get()) !=
+            0) {
+      if (loop->tick_fd != -1) close(loop->tick_fd);
+      if (loop->done_fd != -1) close(loop->done_fd);
+      loop->tick_fd = loop->done_fd = -1;
+      close(loop->epoll_fd);
+      loop->epoll_fd = -1;
+      continue;
+    }
+    started++;
+  }
+  Log() << vntimefunc::GetLocalTimeString() << "Started " << started
+        << " event loop(s)" << std::endl;
+  return started > 0;
+}
+
+void EpollServer::Wait() {
+  for (auto &loop : loops_) {
+    if (loop->epoll_fd != -1) pthread_join(loop->tid, nullptr);
+  }
+}
+
+void *EpollServer::EventLoopWrapper(void *arg) {
+  auto *loop = (EventLoop *)arg;
+  loop->server->RunLoop(*loop);
+  return nullptr;
+}
+
+void EpollServer::RunLoop(EventLoop &loop) {
+  struct epoll_event events[kMaxEvents];
+  while (true) {
+    int n = epoll_wait(loop.epoll_fd, events, kMaxEvents, -1);
+    if (n == -1) {
+      if (errno == EINTR) continue;
+      Log() << vntimefunc::GetLocalTimeString()
+            << "err: epoll_wait fail! caused by " << strerror(errno)
+            << std::endl;
+      break;
+    }
+    for (int i = 0; i < n; i++) {
+      int fd = events[i].data.fd;
+      if (fd == listen_fd_) {
+        AcceptClients(loop);
+        continue;
+      }
+      if (fd == loop.tick_fd) {
+        HandleTick(loop);
+        continue;
+      }
+      if (fd == loop.done_fd) {
+        HandleDone(loop);
+        continue;
+      }
+      auto it = loop.sessions.find(fd);
+      if (it == loop.sessions.end()) continue;
+      ClientSession &session = *it->second;
+      uint32_t ev = events[i].events;
+      if (ev & (EPOLLERR | EPOLLHUP)) {
+        LogClient(session, " disconnected");
+        CloseClient(loop, fd);
+        continue;
+      }
+      if (ev & EPOLLOUT) {
+        if (!FlushClient(loop, session)) {
+          CloseClient(loop, fd);
+          continue;
+        }
+      }
+      if (ev & (EPOLLIN | EPOLLRDHUP)) {
+        bool first_pos = !session.pos_received;
+        if (!ReadClient(session)) {
+          CloseClient(loop, fd);
+          continue;
+        }
+        // Serve the first epoch as soon as the initial position arrives
+        if (first_pos && session.pos_received) {
+          SubmitEpoch(loop, session,
+                      vntimefunc::GpsTimeFromUtc(time(nullptr)));
+        }
+      }
+    }
+    for (int fd : loop.closed_fds) close(fd);
+    loop.closed_fds.clear();
+  }
+}
+
+void EpollServer::AcceptClients(EventLoop &loop) {
+  while (true) {
+    struct sockaddr_in addr {};
+    socklen_t len = sizeof(addr);
+    int fd = accept4(listen_fd_, (struct sockaddr *)&addr, &len,
+                     SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd == -1) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) return;
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      Log() << vntimefunc::GetLocalTimeString()
+            << "Failure accepting client caused by " << strerror(errno)
+            << std::endl;
+      return;
+    }
+    if (num_clients_.load() >= max_clients_) {
+      char client_ip[INET_ADDRSTRLEN];
+      inet_ntop(AF_INET, &(addr.sin_addr), client_ip, INET_ADDRSTRLEN);
+      Log() << vntimefunc::GetLocalTimeString()
+            << "Reject client IP: " << client_ip
+            << " Port: " << ntohs(addr.sin_port)
+            << " since clients reach maximum" << std::endl;
+      close(fd);
+      continue;
+    }
+    AddClient(loop, fd, addr);
+  }
+}
+
+void EpollServer::AddClient(EventLoop &loop, int fd,
+                            const sockaddr_in &addr) {
+  auto session = std::make_unique<ClientSession>();
+  session->fd = fd;
+  session->addr = addr;
+  char client_ip[INET_ADDRSTRLEN];
+  inet_ntop(AF_INET, &(addr.sin_addr), client_ip, INET_ADDRSTRLEN);
+  session->ip = client_ip;
+  session->port = ntohs(addr.sin_port);
+  session->infor.sys.resize(3, true);
+  int on = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (void *)&on, sizeof(on));
+  // Keep the unsent epochs in out_frames, where a stale one is replaced,
+  // rather than in a kernel buffer of up to megabytes
+  int not_sent_lowat = kMaxNotSentBytes;
+  setsockopt(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, (void *)&not_sent_lowat,
+             sizeof(not_sent_lowat));
+  Log() << vntimefunc::GetLocalTimeString() << "accept client IP: "
+        << session->ip << " Port: " << session->port << std::endl;
+  struct epoll_event ev {};
+  ev.events = EPOLLIN | EPOLLRDHUP;
+  ev.data.fd = fd;
+  if (epoll_ctl(loop.epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+    LogClient(*session, " epoll registration failed");
+    close(fd);
+    return;
+  }
+  session->rst_path = "../Log/client_" + session->ip + ":" +
+                      std::to_string(session->port) + "_log.txt";
+  session->rst.Open(session->rst_path, false);
+  session->connect_sec = time(nullptr);
+  Schedule(loop, *session, session->connect_sec);
+  loop.sessions[fd] = std::move(session);
+  num_clients_++;
+}
+
+bool EpollServer::ReadClient(ClientSession &session) {
+  char buff[BUFF_SIZE];
+  while (true) {
+    int ret = recv(session.fd, buff, sizeof(buff), 0);
+    if (ret == -1) {
+      if (errno == EWOULDBLOCK || errno == EAGAIN) break;
+      if (errno == EINTR) continue;
+      LogClient(session, std::string(" closed due to unexpected read error: ") +
+                             strerror(errno));
+      return false;
+    } else if (ret == 0) {  // -> orderly client disconnect
+      LogClient(session, " disconnected");
+      return false;
+    }
+    session.in_buff.append(buff, ret);
+  }
+  // Messages end with "\r\n"; the legacy client pads each message with zeros
+  size_t start = 0;
+  while (true) {
+    size_t end = session.in_buff.find_first_of(std::string("\n\0", 2), start);
+    if (end == std::string::npos) break;
+    std::string message =
+        session.in_buff.substr(start, end - start + (session.in_buff[end] == '\n'));
+    start = end + 1;
+    if (message.find(POSITION_MSG_HEADER) == std::string::npos) continue;
+    LogClient(session, " Position data received");
+    if (!ParsePositionMessage(message, session.pos_ecef, session.infor,
+                              session.period_s)) {
+      LogClient(session, " failure parsing position message");
+    } else {
+      std::stringstream ss;
+      ss << " position (ECEF): " << std::setprecision(12)
+         << session.pos_ecef[0] << " " << session.pos_ecef[1] << " "
+         << session.pos_ecef[2];
+      LogClient(session, ss.str());
+      session.pos_received = true;
+    }
+  }
+  session.in_buff.erase(0, start);
+  if (session.in_buff.size() > BUFF_SIZE) {
+    LogClient(session, " position message too long, discarded");
+    session.in_buff.clear();
+  }
+  return true;
+}
+
+time_t EpollServer::NextEpoch(time_t utc_sec, int period_s) {
+  time_t gps_sec = vntimefunc::GpsTimeFromUtc(utc_sec).time;
+  return (gps_sec / period_s + 1) * period_s - vntimefunc::kGpsLeapSeconds;
+}
+
+void EpollServer::Schedule(EventLoop &loop, ClientSession &session,
+                           time_t after_sec) {
+  session.next_epoch = NextEpoch(after_sec, session.period_s);
+  loop.wheel[session.next_epoch % kWheelSlots].push_back(session.fd);
+}
+
+void EpollServer::HandleTick(EventLoop &loop) {
+  uint64_t expirations;
+  if (read(loop.tick_fd, &expirations, sizeof(expirations)) == -1 &&
+      errno != EAGAIN) {
+    return;
+  }
+  // Not time(), which may lag the tick by a coarse clock period
+  struct timespec ts {};
+  clock_gettime(CLOCK_REALTIME, &ts);
+  time_t now = ts.tv_sec;
+  if (now < loop.wheel_sec || now - loop.wheel_sec >= kWheelSlots) {
+    // The clock was set, schedule every client again from now
+    for (auto &slot : loop.wheel) slot.clear();
+    for (auto &elem : loop.sessions) Schedule(loop, *elem.second, now);
+    loop.wheel_sec = now;
+    return;
+  }
+  while (loop.wheel_sec < now) {
+    ServeEpoch(loop, ++loop.wheel_sec);
+  }
+}
+
+void EpollServer::ServeEpoch(EventLoop &loop, time_t epoch_sec) {
+  std::vector<int> &slot = loop.wheel[epoch_sec % kWheelSlots];
+  loop.due.swap(slot);
+  gtime_t gpst = vntimefunc::GpsTimeFromUtc(epoch_sec);
+  for (int fd : loop.due) {
+    auto it = loop.sessions.find(fd);
+    // Entries of closed clients are dropped here
+    if (it == loop.sessions.end() || it->second->next_epoch != epoch_sec) {
+      continue;
+    }
+    ClientSession &session = *it->second;
+    Schedule(loop, session, epoch_sec);
+    if (!session.pos_received &&
+        epoch_sec - session.connect_sec < SEND_PERIOD / ONE_SEC_PERIOD) {
+      continue;
+    }
+    HandleTimer(session);
+    SubmitEpoch(loop, session, gpst);
+  }
+  loop.due.clear();
+}
+
+void EpollServer::HandleTimer(ClientSession &session) {
+  if (!session.pos_received) {
+    // No position within the first period, serve the server position
+    UseServerPosition(session);
+    session.pos_received = true;
+    LogClient(session, " use server position");
+  }
+}
+
+void EpollServer::SubmitEpoch(EventLoop &loop, ClientSession &session,
+                              gtime_t gpst_now) {
+  // Still generating the previous epoch, skip this one
+  if (session.epoch_pending) return;
+  std::unique_ptr<EpochJob> job;
+  if (loop.free_jobs.empty()) {
+    job = std::make_unique<EpochJob>();
+    job->server = this;
+    job->loop = &loop;
+  } else {
+    job = std::move(loop.free_jobs.back());
+    loop.free_jobs.pop_back();
+  }
+  job->session = &session;
+  job->pos_ecef = session.pos_ecef;
+  job->infor = session.infor;
+  job->gpst = gpst_now;
+  // reset the log file every 24 hours to protect storage
+  job->reset_log = session.iter == 86400;
+  if (job->reset_log) session.iter = 0;
+  job->iter = ++session.iter;
+  session.epoch_pending = true;
+  EpochJob *task = job.release();
+  if (!pool_ || !pool_->Submit(task)) task->Run();
+}
+
+void EpollServer::GenerateEpoch(EpochJob &job) {
+  // Time since the start of the epoch second
+  time_t epoch_sec = job.gpst.time - vntimefunc::kGpsLeapSeconds;
+  struct timespec now {};
+  clock_gettime(CLOCK_REALTIME, &now);
+  int64_t delay_us =
+      (now.tv_sec - epoch_sec) * 1000000LL + now.tv_nsec / 1000;
+  vnmetrics::RecordStage(vnmetrics::kQueueDelay, delay_us > 0 ? delay_us : 0);
+  // The session log is only written by the job while it is pending
+  vnlog::LogStream &rst = job.session->rst;
+  if (job.reset_log) rst.Truncate();
+  if (job.iter % 60 == 1) {  // record log by every 1 minute
+    rst << "Running idx: " << job.iter << std::endl;
+  }
+  uint64_t start_us = vnmetrics::NowUs();
+  // Rovers of the same cell share the epoch of its virtual base station
+  std::shared_ptr<const VrsEpoch> epoch =
+      vrs_cache_->GetEpoch(job.pos_ecef, job.infor, job.gpst, *store_,
+                           *trop_, rst, job.iter);
+  uint64_t epoch_us = vnmetrics::NowUs() - start_us;
+  vnmetrics::RecordStage(vnmetrics::kEpoch, epoch_us);
+  if (epoch_us >= ONE_SEC_PERIOD) {
+    rst << "Warning: Request and Computation time exceed 1s, continue."
+        << std::endl;
+  }
+  job.frame = epoch->rtcm;
+  // Hand the job back to its loop, wake it up if the list was empty
+  EventLoop &loop = *job.loop;
+  EpochJob *head = loop.done.load(std::memory_order_relaxed);
+  do {
+    job.next = head;
+  } while (!loop.done.compare_exchange_weak(head, &job,
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed));
+  if (head == nullptr) {
+    uint64_t one = 1;
+    if (write(loop.done_fd, &one, sizeof(one)) == -1) perror("eventfd");
+  }
+}
+
+void EpollServer::HandleDone(EventLoop &loop) {
+  uint64_t count;
+  if (read(loop.done_fd, &count, sizeof(count)) == -1 && errno != EAGAIN) {
+    return;
+  }
+  // Oldest first
+  EpochJob *list = loop.done.exchange(nullptr, std::memory_order_acquire);
+  EpochJob *ordered = nullptr;
+  while (list != nullptr) {
+    EpochJob *next = list->next;
+    list->next = ordered;
+    ordered = list;
+    list = next;
+  }
+  while (ordered != nullptr) {
+    EpochJob *job = ordered;
+    ordered = job->next;
+    ClientSession *session = job->session;
+    RtcmFramePtr frame = std::move(job->frame);
+    loop.free_jobs.emplace_back(job);
+    session->epoch_pending = false;
+    if (loop.closing.erase(session) > 0) continue;
+    if (!QueueFrame(loop, *session, std::move(frame))) {
+      CloseClient(loop, session->fd);
+    }
+  }
+}
+
+bool EpollServer::QueueFrame(EventLoop &loop, ClientSession &session,
+                             RtcmFramePtr frame) {
+  if (!frame || frame->empty()) return true;
+  // The previous epoch has not drained: a frame partly written must be
+  // completed to keep the RTCM stream intact, the others are replaced. Only
+  // a replaced epoch counts as stale, not a large frame still being written.
+  size_t num_started = session.out_offset > 0 ? 1 : 0;
+  if (session.out_frames.size() > num_started) {
+    while (session.out_frames.size() > num_started) {
+      session.out_bytes -= session.out_frames.back()->size();
+      session.out_frames.pop_back();
+      num_stale_epochs_++;
+    }
+    if (++session.stale_epochs > kMaxStaleEpochs) {
+      LogClient(session, " stalled, client too slow");
+      return false;
+    }
+  }
+  session.out_bytes += frame->size();
+  session.out_frames.push_back(std::move(frame));
+  if (session.out_bytes > kMaxPendingBytes) {
+    LogClient(session, " send buffer overflow, client too slow");
+    return false;
+  }
+  return FlushClient(loop, session);
+}
+
+bool EpollServer::FlushClient(EventLoop &loop, ClientSession &session) {
+  while (!session.out_frames.empty()) {
+    // Gather the pending frames into one sendmsg
+    struct iovec iov[kMaxIov];
+    int n_iov = 0;
+    for (auto it = session.out_frames.begin();
+         it != session.out_frames.end() && n_iov < kMaxIov; ++it, n_iov++) {
+      size_t skip = n_iov == 0 ? session.out_offset : 0;
+      iov[n_iov].iov_base = (void *)((*it)->data() + skip);
+      iov[n_iov].iov_len = (*it)->size() - skip;
+    }
+    struct msghdr msg {};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = n_iov;
+    uint64_t send_us = vnmetrics::NowUs();
+    ssize_t ret = sendmsg(session.fd, &msg, MSG_NOSIGNAL);
+    vnmetrics::RecordStage(vnmetrics::kSend, vnmetrics::NowUs() - send_us);
+    if (ret > 0) {
+      size_t sent = ret;
+      session.out_bytes -= sent;
+      while (sent > 0) {
+        size_t left = session.out_frames.front()->size() - session.out_offset;
+        if (sent < left) {
+          session.out_offset += sent;
+          break;
+        }
+        sent -= left;
+        session.out_frames.pop_front();
+        session.out_offset = 0;
+        session.stale_epochs = 0;
+      }
+      continue;
+    }
+    if (ret == -1 && errno == EINTR) continue;
+    if (ret == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      // Socket buffer full, resume when writable
+      if (!session.want_write) {
+        struct epoll_event ev {};
+        ev.events = EPOLLIN | EPOLLRDHUP | EPOLLOUT;
+        ev.data.fd = session.fd;
+        epoll_ctl(loop.epoll_fd, EPOLL_CTL_MOD, session.fd, &ev);
+        session.want_write = true;
+      }
+      return true;
+    }
+    LogClient(session,
+              std::string(" send error: ") + (ret == -1 ? strerror(errno) : ""));
+    return false;
+  }
+  if (session.want_write) {
+    struct epoll_event ev {};
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.fd = session.fd;
+    epoll_ctl(loop.epoll_fd, EPOLL_CTL_MOD, session.fd, &ev);
+    session.want_write = false;
+  }
+  return true;
+}
+
+void EpollServer::ReclaimJobs(EventLoop &loop) {
+  EpochJob *list = loop.done.exchange(nullptr, std::memory_order_acquire);
+  while (list != nullptr) {
+    EpochJob *next = list->next;
+    loop.free_jobs.emplace_back(list);
+    list = next;
+  }
+}
+
+void EpollServer::CloseClient(EventLoop &loop, int fd) {
+  auto it = loop.sessions.find(fd);
+  if (it == loop.sessions.end()) return;
+  ClientSession &session = *it->second;
+  // Its events later in the batch find no session
+  loop.closed_fds.push_back(session.fd);
+  // A running job still uses the session, freed when it is done
+  if (session.epoch_pending) {
+    loop.closing[&session] = std::move(it->second);
+  }
+  loop.sessions.erase(it);
+  num_clients_--;
+}
+
+void EpollServer::LogClient(const ClientSession &session,
+                            const std::string &msg) {
+  Log() << vntimefunc::GetLocalTimeString() << "client IP: " << session.ip
+        << ", Port: " << session.port << msg << std::endl;
+}
@@ -0,0 +1,149 @@
+#ifndef VN_DGNSS_SERVER_EPOLL_SERVER_H
+#define VN_DGNSS_SERVER_EPOLL_SERVER_H
+
+#pragma once
+#include <pthread.h>
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "async_log.h"
+#include "client_session.h"
+#include "compute_pool.h"
+#include "correction_snapshot.h"
+#include "iggtrop_correction_model.h"
+#include "vrs_cell_cache.h"
+
+// Event-driven RTCM server. Each event loop owns an epoll instance that
+// multiplexes accept, client position messages and disconnects for the
+// clients it accepted, and a timer wheel of one-second slots ticked at each
+// GPS second: the clients due at that epoch are served as one batch. The
+// epochs are generated by a compute pool shared by the loops and handed
+// back to the loop of the client, which only does the socket I/O.
+class EpollServer {
+ public:
+  // num_compute: threads generating the epochs, 0 to generate them in the
+  // event loops
+  EpollServer(int listen_fd, const CorrectionStore *store,
+              const IggtropExperimentModel *trop, VrsCellCache *vrs_cache,
+              int log_sink, int num_loops, int num_compute, int max_clients);
+  ~EpollServer();
+  // Non-copyable
+  EpollServer(const EpollServer &) = delete;
+  EpollServer &operator=(const EpollServer &) = delete;
+
+  // Start the event loop threads, returns false if no loop could be started
+  bool Start();
+  // Block until all event loops exit
+  void Wait();
+  int GetNumOfClients() const { return num_clients_.load(); }
+  // Epochs replaced by a newer one before they reached a slow client
+  uint64_t GetNumOfStaleEpochs() const { return num_stale_epochs_.load(); }
+
+ private:
+  // One-second slots of the timer wheel, more than MAX_SEND_PERIOD_S
+  static constexpr int kWheelSlots = 64;
+
+  struct EventLoop;
+  // Epoch of one client generated in the compute pool (or inline) and
+  // handed back to the event loop of the client
+  struct EpochJob : public ComputeTask {
+    EpollServer *server{};
+    EventLoop *loop{};
+    // Kept alive until the job is done, see CloseClient
+    ClientSession *session{};
+    // Copies of the session state, the loop may change it meanwhile
+    std::vector<double> pos_ecef;
+    GnssSystemInfo infor;
+    gtime_t gpst{};
+    int iter{};
+    bool reset_log{};
+    RtcmFramePtr frame;
+    // Next job of EventLoop::done
+    EpochJob *next{};
+    void Run() override { server->GenerateEpoch(*this); }
+  };
+
+  struct EventLoop {
+    EpollServer *server{};
+    int epoll_fd{-1};
+    pthread_t tid{};
+    // Sessions by socket fd
+    std::unordered_map<int, std::unique_ptr<ClientSession>> sessions;
+    // Timer fd firing at every UTC second boundary
+    int tick_fd{-1};
+    // Last UTC second served
+    time_t wheel_sec{};
+    // Socket fds by the UTC second of their next epoch, modulo kWheelSlots
+    std::vector<int> wheel[kWheelSlots];
+    // Batch being served, kept to reuse its capacity
+    std::vector<int> due;
+    // Jobs done by the pool, newest first, signaled by done_fd (eventfd)
+    std::atomic<EpochJob *> done{nullptr};
+    int done_fd{-1};
+    // Jobs not in use
+    std::vector<std::unique_ptr<EpochJob>> free_jobs;
+    // Sessions closed while their job was running
+    std::unordered_map<ClientSession *, std::unique_ptr<ClientSession>>
+        closing;
+    // Socket fds of the clients closed during the events of one epoll_wait,
+    // closed after them: a later accept of the batch must not reuse an fd
+    // that still has events queued
+    std::vector<int> closed_fds;
+  };
+
+  // Max events handled per epoll_wait
+  static constexpr int kMaxEvents = 256;
+  // Max RTCM bytes pending for a client before it is dropped
+  static constexpr size_t kMaxPendingBytes = 64 * 1024;
+  // Unsent bytes the kernel holds for a client before EAGAIN, a few epochs
+  static constexpr int kMaxNotSentBytes = 4 * 1024;
+  // Max epochs in a row that replaced an unsent one, after which the client
+  // is dropped as stalled
+  static constexpr int kMaxStaleEpochs = 30;
+  // Max frames written by one sendmsg
+  static constexpr int kMaxIov = 16;
+  // Max jobs waiting in the compute pool, the next ones run in the loop
+  static constexpr int kMaxQueuedJobs = 65536;
+
+  const int listen_fd_;
+  const CorrectionStore *store_;
+  const IggtropExperimentModel *trop_;
+  VrsCellCache *vrs_cache_;
+  // vnlog sink of the server log, shared by the event loops
+  const int log_sink_;
+  const int max_clients_;
+  std::atomic<int> num_clients_{0};
+  std::atomic<uint64_t> num_stale_epochs_{0};
+  std::vector<std::unique_ptr<EventLoop>> loops_;
+  std::unique_ptr<ComputePool> pool_;
+
+  static void *EventLoopWrapper(void *arg);
+  void RunLoop(EventLoop &loop);
+  void AcceptClients(EventLoop &loop);
+  void AddClient(EventLoop &loop, int fd, const sockaddr_in &addr);
+  bool ReadClient(ClientSession &session);
+  // First UTC second after utc_sec at a GPS second multiple of period_s
+  static time_t NextEpoch(time_t utc_sec, int period_s);
+  void Schedule(EventLoop &loop, ClientSession &session, time_t after_sec);
+  void HandleTick(EventLoop &loop);
+  void ServeEpoch(EventLoop &loop, time_t epoch_sec);
+  void HandleTimer(ClientSession &session);
+  // Generate the epoch gpst_now of the session unless one is pending
+  void SubmitEpoch(EventLoop &loop, ClientSession &session, gtime_t gpst_now);
+  // Compute thread: generate the epoch, then hand the job to its loop
+  void GenerateEpoch(EpochJob &job);
+  void HandleDone(EventLoop &loop);
+  // Take back the jobs the loop handed to the pool and not yet freed
+  static void ReclaimJobs(EventLoop &loop);
+  bool QueueFrame(EventLoop &loop, ClientSession &session,
+                  RtcmFramePtr frame);
+  bool FlushClient(EventLoop &loop, ClientSession &session);
+  void CloseClient(EventLoop &loop, int fd);
+  void LogClient(const ClientSession &session, const std::string &msg);
+  std::ostream &Log() { return vnlog::ThreadStream(log_sink_); }
+};
+
+#endif  // VN_DGNSS_SERVER_EPOLL_SERVER_H
@@ -0,0 +1,180 @@
+#include "metrics_server.h"
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "async_log.h"
+#include "stage_metrics.h"
+
+static const char *const kSysNames[3] = {"GPS", "GAL", "BDS"};
+
+MetricsServer::MetricsServer(const CorrectionStore *store,
+                             const EpollServer *server,
+                             VrsCellCache *vrs_cache)
+    : store_(store), server_(server), vrs_cache_(vrs_cache) {}
+
+MetricsServer::~MetricsServer() {
+  if (listen_fd_ != -1) {
+    shutdown(listen_fd_, SHUT_RDWR);
+    pthread_join(tid_, nullptr);
+    close(listen_fd_);
+  }
+}
+
+bool MetricsServer::Start(uint16_t port) {
+  listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd_ == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString()
+              << "err: create metrics socket fail! caused by "
+              << strerror(errno) << std::endl;
+    return false;
+  }
+  int reuse = 1;
+  setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  struct sockaddr_in addr {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(listen_fd_, (struct sockaddr *)&addr, sizeof(addr)) == -1 ||
+      listen(listen_fd_, 16) == -1) {
+    std::cerr << vntimefunc::GetLocalTimeString() << "err: metrics port "
+              << port << " fail! caused by " << strerror(errno) << std::endl;
+    close(listen_fd_);
+    listen_fd_ = -1;
+    return false;
+  }
+  if (pthread_create(&tid_, nullptr, ServeWrapper, this) != 0) {
+    std::cerr << vntimefunc::GetLocalTimeString()
+              << "err: create metrics thread fail!" << std::endl;
+    close(listen_fd_);
+    listen_fd_ = -1;
+    return false;
+  }
+  return true;
+}
+
+void *MetricsServer::ServeWrapper(void *arg) {
+  static_cast<MetricsServer *>(arg)->Serve();
+  return nullptr;
+}
+
+// One scrape at a time: read the request line, answer and close
+void MetricsServer::Serve() {
+  while (true) {
+    int fd = accept(listen_fd_, nullptr, nullptr);
+    if (fd == -1) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      return;
+    }
+    struct timeval timeout {kRecvTimeout, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    char request[kMaxRequest];
+    ssize_t n = recv(fd, request, sizeof(request) - 1, 0);
+    if (n > 0) {
+      request[n] = '\0';
+      std::string response;
+      if (strncmp(request, "GET /metrics", 12) == 0 ||
+          strncmp(request, "GET / ", 6) == 0) {
+        std::string body = Render();
+        response =
+            "HTTP/1.0 200 OK\r\n"
+            "Content-Type: text/plain; version=0.0.4\r\n"
+            "Content-Length: " +
+            std::to_string(body.size()) + "\r\n\r\n" + body;
+      } else {
+        response = "HTTP/1.0 404 Not Found\r\nContent-Length: 0\r\n\r\n";
+      }
+      for (size_t sent = 0; sent < response.size();) {
+        ssize_t ret = send(fd, response.data() + sent, response.size() - sent,
+                           MSG_NOSIGNAL);
+        if (ret <= 0) break;
+        sent += ret;
+      }
+    }
+    close(fd);
+  }
+}
+
+std::string MetricsServer::Render() const {
+  std::ostringstream out;
+  out << std::setprecision(9);
+  out << "# HELP vn_dgnss_stage_seconds Latency of the epoch pipeline stages\n"
+      << "# TYPE vn_dgnss_stage_seconds histogram\n";
+  for (int s = 0; s < vnmetrics::kNumStages; s++) {
+    auto stage = (vnmetrics::Stage)s;
+    const vnmetrics::LatencyHistogram &hist = vnmetrics::StageHistogram(stage);
+    const char *name = vnmetrics::StageName(stage);
+    uint64_t count = 0;
+    for (int i = 0; i < vnmetrics::LatencyHistogram::kNumBuckets; i++) {
+      count += hist.Count(i);
+      out << "vn_dgnss_stage_seconds_bucket{stage=\"" << name << "\",le=\""
+          << vnmetrics::LatencyHistogram::UpperBoundUs(i) * 1e-6 << "\"} "
+          << count << '\n';
+    }
+    count += hist.Count(vnmetrics::LatencyHistogram::kNumBuckets);
+    out << "vn_dgnss_stage_seconds_bucket{stage=\"" << name
+        << "\",le=\"+Inf\"} " << count << '\n'
+        << "vn_dgnss_stage_seconds_sum{stage=\"" << name << "\"} "
+        << hist.SumUs() * 1e-6 << '\n'
+        << "vn_dgnss_stage_seconds_count{stage=\"" << name << "\"} " << count
+        << '\n';
+  }
+
+  std::vector<double> date(6, 0);
+  int doy;
+  gtime_t gpst_now;
+  vntimefunc::GetGpsTimeNow(date, doy, gpst_now);
+  out << "# HELP vn_dgnss_correction_age_seconds Age of the latest "
+         "corrections\n"
+      << "# TYPE vn_dgnss_correction_age_seconds gauge\n";
+  for (int sys_i = 0; sys_i < 3; sys_i++) {
+    gtime_t orbit_time{}, clock_time{};
+    if (store_->Orbit(sys_i).Read(0, [&](const SatOrbitCorrEpoch &epoch) {
+          orbit_time = epoch.time;
+        })) {
+      out << "vn_dgnss_correction_age_seconds{type=\"orbit\",sys=\""
+          << kSysNames[sys_i] << "\"} " << timediff(gpst_now, orbit_time)
+          << '\n';
+    }
+    if (store_->Clock(sys_i).Read(0, [&](const SatClockCorrEpoch &epoch) {
+          clock_time = epoch.time;
+        })) {
+      out << "vn_dgnss_correction_age_seconds{type=\"clock\",sys=\""
+          << kSysNames[sys_i] << "\"} " << timediff(gpst_now, clock_time)
+          << '\n';
+    }
+  }
+  const VTecCorrection &vtec = store_->Acquire()->vtec_ssr;
+  if (vtec.received) {
+    out << "vn_dgnss_correction_age_seconds{type=\"vtec\"} "
+        << timediff(gpst_now, vtec.time) << '\n';
+  }
+
+  out << "# HELP vn_dgnss_satellites Satellites with usable ephemeris and "
+         "SSR\n"
+      << "# TYPE vn_dgnss_satellites gauge\n";
+  for (int sys_i = 0; sys_i < 3; sys_i++) {
+    out << "vn_dgnss_satellites{sys=\"" << kSysNames[sys_i] << "\"} "
+        << vnmetrics::GetNumOfSat(sys_i) << '\n';
+  }
+  out << "# HELP vn_dgnss_clients Connected clients\n"
+      << "# TYPE vn_dgnss_clients gauge\n"
+      << "vn_dgnss_clients " << server_->GetNumOfClients() << '\n'
+      << "# HELP vn_dgnss_stale_epochs_total Epochs replaced by a newer one "
+         "before reaching a slow client\n"
+      << "# TYPE vn_dgnss_stale_epochs_total counter\n"
+      << "vn_dgnss_stale_epochs_total " << server_->GetNumOfStaleEpochs()
+      << '\n'
+      << "# HELP vn_dgnss_vrs_cells Virtual base station cells\n"
+      << "# TYPE vn_dgnss_vrs_cells gauge\n"
+      << "vn_dgnss_vrs_cells " << vrs_cache_->GetNumOfCells() << '\n'
+      << "# HELP vn_dgnss_log_dropped_total Log records dropped, queue full\n"
+      << "# TYPE vn_dgnss_log_dropped_total counter\n"
+      << "vn_dgnss_log_dropped_total " << vnlog::GetNumDropped() << '\n';
+  return out.str();
+}
@@ -0,0 +1,46 @@
+#ifndef VN_DGNSS_SERVER_METRICS_SERVER_H
+#define VN_DGNSS_SERVER_METRICS_SERVER_H
+
+#pragma once
+#include <pthread.h>
+
+#include <string>
+
+#include "correction_snapshot.h"
+#include "epoll_server.h"
+#include "vrs_cell_cache.h"
+
+// Plain text metrics of the process (Prometheus exposition format) served
+// over HTTP on a local port: stage latency histograms, correction ages,
+// clients, VRS cells and satellites per system.
+class MetricsServer {
+ public:
+  MetricsServer(const CorrectionStore *store, const EpollServer *server,
+                VrsCellCache *vrs_cache);
+  ~MetricsServer();
+  // Non-copyable
+  MetricsServer(const MetricsServer &) = delete;
+  MetricsServer &operator=(const MetricsServer &) = delete;
+
+  // Listen on 127.0.0.1:port and serve from a thread, false on failure
+  bool Start(uint16_t port);
+  // Metrics at the time of the call
+  std::string Render() const;
+
+ private:
+  // Max bytes of a request read, the rest is ignored
+  static constexpr int kMaxRequest = 1024;
+  // Receive timeout of a scrape connection (s)
+  static constexpr int kRecvTimeout = 1;
+
+  const CorrectionStore *store_;
+  const EpollServer *server_;
+  VrsCellCache *vrs_cache_;
+  int listen_fd_{-1};
+  pthread_t tid_{};
+
+  static void *ServeWrapper(void *arg);
+  void Serve();
+};
+
+#endif  // VN_DGNSS_SERVER_METRICS_SERVER_H
@@ -0,0 +1,106 @@
+#include "vrs_cell_cache.h"
+
+#include <cmath>
+
+bool VrsCellKey::operator==(const VrsCellKey &other) const {
+  return lat_idx == other.lat_idx && lon_idx == other.lon_idx &&
+         h_idx == other.h_idx && code_F1[0] == other.code_F1[0] &&
+         code_F1[1] == other.code_F1[1] && code_F1[2] == other.code_F1[2];
+}
+
+size_t VrsCellKeyHash::operator()(const VrsCellKey &key) const {
+  size_t h = std::hash<int>()(key.lat_idx);
+  for (int v : {key.lon_idx, key.h_idx, key.code_F1[0], key.code_F1[1],
+                key.code_F1[2]}) {
+    h ^= std::hash<int>()(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+  }
+  return h;
+}
+
+VrsCellCache::VrsCellCache(double cell_size_deg, double cell_height_m)
+    : cell_size_rad_(cell_size_deg * D2R), cell_height_m_(cell_height_m) {}
+
+VrsCellKey VrsCellCache::MakeKey(const std::vector<double> &pos_ecef,
+                                 const GnssSystemInfo &infor) const {
+  double LLA[3];
+  ecef2pos(pos_ecef.data(), LLA);
+  VrsCellKey key;
+  key.lat_idx = (int)floor(LLA[0] / cell_size_rad_);
+  key.lon_idx = (int)floor(LLA[1] / cell_size_rad_);
+  key.h_idx = (int)floor(LLA[2] / cell_height_m_);
+  for (int i = 0; i < 3; i++) {
+    key.code_F1[i] = infor.sys[i] ? infor.code_F1[i] : 0;
+  }
+  return key;
+}
+
+std::vector<double> VrsCellCache::GetCellCenter(const VrsCellKey &key) const {
+  double LLA[3];
+  LLA[0] = (key.lat_idx + 0.5) * cell_size_rad_;
+  LLA[1] = (key.lon_idx + 0.5) * cell_size_rad_;
+  LLA[2] = (key.h_idx + 0.5) * cell_height_m_;
+  std::vector<double> center(3, 0);
+  pos2ecef(LLA, center.data());
+  return center;
+}
+
+std::shared_ptr<VrsCellCache::VrsCell> VrsCellCache::FindCell(
+    const VrsCellKey &key) {
+  time_t now = time(nullptr);
+  std::lock_guard<std::mutex> lock(map_mutex_);
+  // Drop the cells no rover asked for recently
+  if (now - last_sweep_ >= kCellIdleTimeout) {
+    for (auto it = cells_.begin(); it != cells_.end();) {
+      if (now - it->second->last_used.load() >= kCellIdleTimeout) {
+        it = cells_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    last_sweep_ = now;
+  }
+  auto &cell = cells_[key];
+  if (!cell) {
+    cell = std::make_shared<VrsCell>();
+    cell->center_ecef = GetCellCenter(key);
+  }
+  cell->last_used = now;
+  return cell;
+}
+
+std::shared_ptr<const VrsEpoch> VrsCellCache::GetEpoch(
+    const std::vector<double> &pos_ecef, const GnssSystemInfo &infor,
+    gtime_t gpst_now, const CorrectionStore &store,
+    const IggtropExperimentModel &trop, std::ostream &rst, int log_count) {
+  std::shared_ptr<VrsCell> cell = FindCell(MakeKey(pos_ecef, infor));
+  std::shared_ptr<const SatStateTable> table =
+      sat_states_.Acquire(store, gpst_now);
+  uint64_t corr_version = table->GetCorrVersion();
+
+  std::lock_guard<std::mutex> lock(cell->mutex);
+  if (cell->epoch && cell->epoch->time.time == gpst_now.time &&
+      cell->epoch->corr_version == corr_version) {
+    return cell->epoch;
+  }
+  auto epoch = std::make_shared<VrsEpoch>();
+  EpochGenerationHelper genRTCM(cell->center_ecef);
+  auto frame = std::make_shared<std::vector<unsigned char>>();
+  epoch->valid =
+      genRTCM.ConstructGnssMeas(*table, rst, infor, trop, log_count) &&
+      genRTCM.EncodeRtcmMsg(cell->encoder, *frame);
+  if (epoch->valid) epoch->rtcm = std::move(frame);
+  epoch->time = genRTCM.GetEpochTime();
+  epoch->corr_version = genRTCM.GetCorrVersion();
+  epoch->sta_pos = cell->center_ecef;
+  if (epoch->valid) {
+    epoch->num_sv = genRTCM.GetNumOfSat();
+    epoch->obs = genRTCM.GetObservations();
+  }
+  cell->epoch = epoch;
+  return epoch;
+}
+
+size_t VrsCellCache::GetNumOfCells() {
+  std::lock_guard<std::mutex> lock(map_mutex_);
+  return cells_.size();
+}
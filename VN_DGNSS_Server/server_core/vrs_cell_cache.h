@@ -0,0 +1,91 @@
+#ifndef VN_DGNSS_SERVER_VRS_CELL_CACHE_H
+#define VN_DGNSS_SERVER_VRS_CELL_CACHE_H
+
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "correction_snapshot.h"
+#include "epoch_generation_helper.h"
+#include "iggtrop_correction_model.h"
+
+// Grid cell of a virtual base station: quantized geodetic position plus the
+// code set requested by the rover
+struct VrsCellKey {
+  int lat_idx{}, lon_idx{}, h_idx{};
+  // Requested code on freq 1 per system, 0 when the system is disabled
+  int code_F1[3]{};
+  bool operator==(const VrsCellKey &other) const;
+};
+
+struct VrsCellKeyHash {
+  size_t operator()(const VrsCellKey &key) const;
+};
+
+// One generated epoch of a virtual base station
+struct VrsEpoch {
+  gtime_t time{};
+  // Version of the correction snapshot used to generate the epoch
+  uint64_t corr_version{};
+  // False when not enough satellites could be generated
+  bool valid{};
+  // Position of the virtual base station (ECEF)
+  std::vector<double> sta_pos;
+  std::vector<obsd_t> obs;
+  int num_sv{};
+  // Encoded RTCM (1005 + MSM4) of the epoch, sent as is to every rover of
+  // the cell
+  RtcmFramePtr rtcm;
+};
+
+// Cache of virtual base station epochs shared by the rovers of a cell
+class VrsCellCache {
+ public:
+  // cell_size_deg: lat/lon size of a cell, cell_height_m: height band
+  VrsCellCache(double cell_size_deg, double cell_height_m);
+  // Non-copyable
+  VrsCellCache(const VrsCellCache &) = delete;
+  VrsCellCache &operator=(const VrsCellCache &) = delete;
+
+  VrsCellKey MakeKey(const std::vector<double> &pos_ecef,
+                     const GnssSystemInfo &infor) const;
+  // Position (ECEF) of the virtual base station of a cell
+  std::vector<double> GetCellCenter(const VrsCellKey &key) const;
+  // Epoch of the GPS second gpst_now for the cell of the rover. It is
+  // generated by the first rover of the cell asking for it, the other rovers
+  // of the cell get the same epoch.
+  std::shared_ptr<const VrsEpoch> GetEpoch(
+      const std::vector<double> &pos_ecef, const GnssSystemInfo &infor,
+      gtime_t gpst_now, const CorrectionStore &store,
+      const IggtropExperimentModel &trop, std::ostream &rst, int log_count);
+  size_t GetNumOfCells();
+
+ private:
+  struct VrsCell {
+    // Held while the epoch of the cell is generated
+    std::mutex mutex;
+    std::vector<double> center_ecef;
+    // RTCM stream of the cell, lock times carried across its epochs
+    RtcmStreamEncoder encoder;
+    std::shared_ptr<const VrsEpoch> epoch;
+    std::atomic<time_t> last_used{};
+  };
+  // Cells not used for this long are removed, in seconds
+  static constexpr int kCellIdleTimeout = 60;
+
+  const double cell_size_rad_;
+  const double cell_height_m_;
+  std::mutex map_mutex_;
+  std::unordered_map<VrsCellKey, std::shared_ptr<VrsCell>, VrsCellKeyHash>
+      cells_;
+  time_t last_sweep_{};
+  // Satellite states of the current second, shared by all the cells
+  SatStateCache sat_states_;
+
+  std::shared_ptr<VrsCell> FindCell(const VrsCellKey &key);
+};
+
+#endif  // VN_DGNSS_SERVER_VRS_CELL_CACHE_H
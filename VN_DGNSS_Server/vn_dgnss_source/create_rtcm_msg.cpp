@@ -1,7 +1,5 @@
 #include "create_rtcm_msg.h"
 
-#define NINCOBS 262144 /* inclimental number of obs data */
-
 /* test rtcm nav data --------------------------------------------------------*/
 static bool IsNav(int type) {
   return type == 1019 || type == 1044 || type == 1045 || type == 1046;
@@ -33,11 +31,9 @@ static void InitStationPara(sta_t *sta) {
 }
 
 /* generate rtcm obs data messages -------------------------------------------*/
-static void GenerateRtcmObsMsg(rtcm_t *rtcm, const int *type,
-                         int n, SockRTCM *client_info) {
+static void GenerateRtcmObsMsg(rtcm_t *rtcm, const int *type, int n,
+                               std::vector<unsigned char> &out) {
   int i, j = 0;
-  char client_ip[INET_ADDRSTRLEN];
-  inet_ntop(AF_INET, &(client_info->addr.sin_addr), client_ip, INET_ADDRSTRLEN);
   for (i = 0; i < n; i++) {
     if (IsNav(type[i]) || IsGNav(type[i]) || IsAnt(type[i])) continue;
     j = i; /* index of last message */
@@ -46,48 +42,18 @@ static void GenerateRtcmObsMsg(rtcm_t *rtcm, const int *type,
     if (IsNav(type[i]) || IsGNav(type[i]) || IsAnt(type[i])) continue;
 
     if (!gen_rtcm3(rtcm, type[i], i != j)) continue;
-    // if (fwrite(rtcm->buff,rtcm->nbyte,1,fp)<1) break;
-    int ret = send(client_info->fd, rtcm->buff, rtcm->nbyte, MSG_NOSIGNAL);
-    if (ret == -1){
-      *client_info->log << vntimefunc::GetLocalTimeString() <<"Client IP: "<< client_ip
-                        << ", Port: "<< ntohs(client_info->addr.sin_port)
-                        << " send error: " << strerror(errno)
-                        << std::endl;
-      client_info->send_check = false;
-    }
-    else if(ret == 0){
-      *client_info->log << vntimefunc::GetLocalTimeString() <<"client IP: "<< client_ip
-                        << ", Port: "<< ntohs(client_info->addr.sin_port)
-                        << " disconnected when sending data " << strerror(errno)
-                        << std::endl;
-    }
+    out.insert(out.end(), rtcm->buff, rtcm->buff + rtcm->nbyte);
   }
 }
 /* generate rtcm antenna info messages ---------------------------------------*/
-static void GenerateRtcmAntMsg(rtcm_t *rtcm, const int *type,
-                         int n, SockRTCM *client_info) {
+static void GenerateRtcmAntMsg(rtcm_t *rtcm, const int *type, int n,
+                               std::vector<unsigned char> &out) {
   int i;
-  char client_ip[INET_ADDRSTRLEN];
-  inet_ntop(AF_INET, &(client_info->addr.sin_addr), client_ip, INET_ADDRSTRLEN);
   for (i = 0; i < n; i++) {
     if (!IsAnt(type[i])) continue;
 
     if (!gen_rtcm3(rtcm, type[i], 0)) continue;
-    // if (fwrite(rtcm->buff,rtcm->nbyte,1,fp)<1) break;
-    int ret = send(client_info->fd, rtcm->buff, rtcm->nbyte, MSG_NOSIGNAL);
-    if (ret == -1){
-      *client_info->log << vntimefunc::GetLocalTimeString() <<"client IP: "<< client_ip
-                        << ", Port: "<< ntohs(client_info->addr.sin_port)
-                        << " send error: " << strerror(errno)
-                        << std::endl;
-      client_info->send_check = false;
-    }
-    else if(ret == 0){
-      *client_info->log << vntimefunc::GetLocalTimeString() <<"client IP: "<< client_ip
-                        << ", Port: "<< ntohs(client_info->addr.sin_port)
-                        << " disconnected when sending data " << strerror(errno)
-                        << std::endl;
-    }
+    out.insert(out.end(), rtcm->buff, rtcm->buff + rtcm->nbyte);
   }
 }
 
@@ -100,64 +66,17 @@ static void ResetSlips(unsigned char slips[][NFREQ], obsd_t *data) {
   }
 }
 
-/* add obs data --------------------------------------------------------------*/
-static int AddObservationData(obs_t *obs, const obsd_t *data) {
-  obsd_t *obs_data;
-
-  if (obs->nmax <= obs->n) {
-    if (obs->nmax <= 0)
-      obs->nmax = NINCOBS;
-    else
-      obs->nmax *= 2;
-    if (!(obs_data =
-              (obsd_t *)realloc(obs->data, sizeof(obsd_t) * obs->nmax))) {
-      // trace(1,"AddObservationData: memalloc error
-      // n=%dx%d\n",sizeof(obsd_t),obs->nmax);
-      free(obs->data);
-      obs->data = nullptr;
-      obs->n = obs->nmax = 0;
-      return -1;
-    }
-    obs->data = obs_data;
-  }
-  obs->data[obs->n++] = *data;
-  return 1;
-}
-
 /* convert to rtcm messages --------------------------------------------------*/
-static int ConvertMeasToRtcm(const int *type, int n, SockRTCM *client_info,
-                     const obs_t *obs, const nav_t *nav, const sta_t *sta,
-                     int staid)  // vector<vector<gtime_t>> &lltime_rcd)
-{
-  // FILE *fp=stdout;
-  gtime_t time0 = {0};
-  rtcm_t rtcm = {0};
-  eph_t eph0 = {0};
-  geph_t geph0 = {0};
-  /*
-  for (int u = 0;u<MAXSAT;u++){
-      for (int ui = 0;ui<NFREQ+NEXOBS;ui++){
-          rtcm.lltime[u][ui] = lltime_rcd[u][ui];
-      }
-  }*/
-  int i, j, prn, index[2] = {0};
+static int ConvertMeasToRtcm(rtcm_t *rtcm, const int *type, int n,
+                             std::vector<unsigned char> &out,
+                             const obs_t *obs) {
+  int i, j;
 
-  if (!(rtcm.nav.eph = (eph_t *)malloc(sizeof(eph_t) * MAXSAT)) ||
-      !(rtcm.nav.geph = (geph_t *)malloc(sizeof(geph_t) * MAXPRNGLO)))
-    return 0;
+  /* the station data never change, keep the issue of data station */
+  rtcm->seqno = 0;
 
-  rtcm.staid = staid;
-  rtcm.sta = *sta;
-
-  for (i = 0; i < MAXSAT; i++) rtcm.nav.eph[i] = eph0;
-  for (i = 0; i < MAXPRNGLO; i++) rtcm.nav.geph[i] = geph0;
-  /* update glonass freq channel number */
-  for (i = 0; i < nav->ng; i++) {
-    if (satsys(nav->geph[i].sat, &prn) != SYS_GLO) continue;
-    rtcm.nav.geph[prn - 1] = nav->geph[i];
-  }
   /* gerate rtcm antenna info messages */
-  GenerateRtcmAntMsg(&rtcm, type, n, client_info);
+  GenerateRtcmAntMsg(rtcm, type, n, out);
 
   for (i = 0; i < obs->n; i = j) {
     /* extract epoch obs data */
@@ -167,101 +86,166 @@ static int ConvertMeasToRtcm(const int *type, int n, SockRTCM *client_info,
         break;
       }
     }
-    rtcm.time = obs->data[i].time;
-    rtcm.seqno++;
-    rtcm.obs.data = obs->data + i;
-    rtcm.obs.n = j - i;
+    rtcm->time = obs->data[i].time;
+    rtcm->seqno++;
+    rtcm->obs.data = obs->data + i;
+    rtcm->obs.n = j - i;
     /* generate rtcm obs data messages */
-    GenerateRtcmObsMsg(&rtcm, type, n, client_info);
-    // fprintf(stderr,"NOBS=%2d\r",rtcm.obs.n);
+    GenerateRtcmObsMsg(rtcm, type, n, out);
+  }
+  return 1;
+}
+
+/* rtcm control struct of the calling thread ---------------------------------*/
+static rtcm_t *GetThreadRtcm() {
+  /* only GLONASS msm reads the ephemerides (for the frequency channel), keep
+     an empty table */
+  struct ThreadRtcm {
+    rtcm_t rtcm{};
+    geph_t geph[MAXPRNGLO]{};
+  };
+  thread_local std::unique_ptr<ThreadRtcm> thread_rtcm;
+  if (!thread_rtcm) {
+    thread_rtcm = std::make_unique<ThreadRtcm>();
+    rtcm_t *rtcm = &thread_rtcm->rtcm;
+    rtcm->nav.geph = thread_rtcm->geph;
+    rtcm->staid = 0; /*Station ID*/
+    /* Generate "sta" */
+    InitStationPara(&rtcm->sta);
+    rtcm->sta.name[0] = 'U';
+    rtcm->sta.name[1] = 'C';
+    rtcm->sta.name[2] = 'R';
   }
+  return &thread_rtcm->rtcm;
+}
 
-  /* print statistics  */
-  // fprintf(stderr,"\n  MT  # OF MSGS\n");
-  // memcpy(lltime_rcd.data(),rtcm.lltime,sizeof(lltime_rcd[0][0])*MAXSAT*(NFREQ+NEXOBS));
-  /*for (int u = 0;u<MAXSAT;u++){
-      for (int ui = 0;ui<NFREQ+NEXOBS;ui++){
-          lltime_rcd[u][ui] = rtcm.lltime[u][ui];
+/* true if a signal of the epoch has phase ----------------------------------*/
+static bool HasPhase(const std::vector<obsd_t> &data) {
+  for (const obsd_t &obs : data) {
+    for (int j = 0; j < NFREQ + NEXOBS; j++) {
+      if (obs.code[j] && obs.L[j] != 0.0) return true;
+    }
+  }
+  return false;
+}
+
+/* flag a slip on the signals without phase or missing from the previous
+   epoch of the stream, which restarts their lock time -----------------------*/
+void RtcmStreamEncoder::MarkSlips() {
+  for (obsd_t &obs : data_) {
+    if (obs.sat <= 0 || obs.sat > MAXSAT) continue;
+    for (int j = 0; j < NFREQ + NEXOBS; j++) {
+      if (!obs.code[j]) continue;
+      uint32_t &last = last_epoch_[(obs.sat - 1) * (NFREQ + NEXOBS) + j];
+      if (obs.L[j] == 0.0 || last == 0 || num_epochs_ - last > 1) {
+        obs.LLI[j] |= LLI_SLIP;
       }
-  }*/
-  //    for (i=1;i<299;i++) {
-  //        if (!rtcm.nmsg3[i]) continue;
-  //        fprintf(stderr,"%04d %10d\n",1000+i,rtcm.nmsg3[i]);
-  //    }
-  //    fprintf(stderr,"\n");
-  free(rtcm.nav.eph);
-  free(rtcm.nav.geph);
-  return 1;
+      last = obs.L[j] == 0.0 ? 0 : num_epochs_;
+    }
+  }
 }
 
-/* main ----------------------------------------------------------------------*/
-int CreateRtcmMsg(int n, const int *type, int m, SockRTCM *client_info,
-              std::vector<double> sta_pos, std::vector<obsd_t> data_obs) {
-  int staid = 0; /*Station ID*/
-  nav_t nav = {0};
-  int stat = 0;
-  sta_t sta = {{0}};
-  int i, ret = 0;
-  // insert data example:
-  /* Initialize RTKLIB struct */
-  obs_t obs = {0};
-  obsd_t *data;
-  data = (obsd_t *)malloc(sizeof(obsd_t) *
-          MAXOBS); /*See in RTKLIB func: readrnxobs*/
-  for (i = 0; i < MAXOBS; i++) {
-    data[i].time = data_obs[i].time;
-    data[i].sat = data_obs[i].sat;
-    int prn,sv;
-    sv = satsys(data[i].sat,&prn);
-//    *client_info->rtcm_log << "Sat: " << (int)data[i].sat
-//                          << " SV: " << sv << " PRN: " << prn << std::endl;
-    data[i].rcv = data_obs[i].rcv;
-    for (int k = 0; k < NFREQ + NEXOBS; k++) {
-      data[i].P[k] = data_obs[i].P[k];
-      data[i].L[k] = data_obs[i].L[k];
-      data[i].D[k] = data_obs[i].D[k];
-      data[i].SNR[k] = data_obs[i].SNR[k];
-      data[i].LLI[k] = data_obs[i].LLI[k];
-      data[i].code[k] = data_obs[i].code[k];
-      data[i].lockt[k] = data_obs[i].lockt[k];
-//      if (i < n) {
-//        *client_info->rtcm_log << "Code: " << data[i].P[k]
-//                              << " Phase: " << data[i].L[k]
-//                              << " SNR: " << (int)data[i].SNR[k]
-//                              << " LLI: " << (int)data[i].LLI[k]
-//                              << " channel: " << (int)data[i].code[k]
-//                              << " lockt: " << data[i].lockt[k] << std::endl;
-//      }
+void RtcmStreamEncoder::LoadSignals(rtcm_t *rtcm) const {
+  for (const obsd_t &obs : data_) {
+    if (obs.sat <= 0 || obs.sat > MAXSAT) continue;
+    for (int j = 0; j < NFREQ + NEXOBS; j++) {
+      int k = (obs.sat - 1) * (NFREQ + NEXOBS) + j;
+      rtcm->cp[obs.sat - 1][j] = cp_[k];
+      rtcm->lltime[obs.sat - 1][j] = lltime_[k];
     }
   }
-  /*Save data tp obs struct*/
-  for (i = 0; i < n; i++) {
-    /* save obs data */
-    if ((stat = AddObservationData(&obs, data + i)) < 0) break;
+}
+
+void RtcmStreamEncoder::SaveSignals(const rtcm_t *rtcm) {
+  for (const obsd_t &obs : data_) {
+    if (obs.sat <= 0 || obs.sat > MAXSAT) continue;
+    for (int j = 0; j < NFREQ + NEXOBS; j++) {
+      int k = (obs.sat - 1) * (NFREQ + NEXOBS) + j;
+      cp_[k] = rtcm->cp[obs.sat - 1][j];
+      lltime_[k] = rtcm->lltime[obs.sat - 1][j];
+    }
   }
-  free(data);
-  /* Generate "sta" */
-  InitStationPara(&sta);
-  for (int j = 0; j < 3; j++) sta.pos[j] = sta_pos[j];
-  sta.del[0] = 0;
-  sta.del[1] = 0;
-  sta.del[2] = 0;
-  sta.name[0] = 'U';
-  sta.name[1] = 'C';
-  sta.name[2] = 'R';
+}
+
+/* encode the next epoch of the stream into a byte buffer --------------------*/
+int RtcmStreamEncoder::Encode(int n, const int *type, int m,
+                              const std::vector<double> &sta_pos,
+                              const std::vector<obsd_t> &data_obs,
+                              std::vector<unsigned char> &out) {
+  if (n < 0 || n > (int)data_obs.size()) return -1;
+  /* sortobs reorders in place, work on a copy of the n used entries only */
+  data_.assign(data_obs.begin(), data_obs.begin() + n);
+  obs_t obs = {0};
+  obs.data = data_.data();
+  obs.n = obs.nmax = n;
+  rtcm_t *rtcm = GetThreadRtcm();
+  for (int j = 0; j < 3; j++) rtcm->sta.pos[j] = sta_pos[j];
 
-  /*Convert to RTCM message*/
-  // int type[16];
-  // int m = 2, staid = 0; /*Number of message type, Station ID*/
-  // type[0] = 1001; type[1]=1005; /* Define massage type */
   sortobs(&obs);
+  data_.resize(obs.n); /* duplicates deleted by sortobs */
+
+  /* an epoch encoded again (newer corrections) keeps the lock times */
+  if (obs.n > 0 && timediff(obs.data[0].time, last_time_) != 0.0) {
+    num_epochs_++;
+    last_time_ = obs.data[0].time;
+  }
+  /* without phase every signal slips, which resets its ambiguity and lock
+     time in the rtcm_t, so no per signal state is needed */
+  bool has_phase = HasPhase(data_);
+  if (has_phase) {
+    if (cp_.empty()) {
+      cp_.assign(MAXSAT * (NFREQ + NEXOBS), 0.0);
+      lltime_.assign(MAXSAT * (NFREQ + NEXOBS), gtime_t{});
+      last_epoch_.assign(MAXSAT * (NFREQ + NEXOBS), 0);
+    }
+    MarkSlips();
+    LoadSignals(rtcm);
+  } else {
+    for (obsd_t &d : data_) {
+      for (int j = 0; j < NFREQ + NEXOBS; j++) {
+        if (d.code[j]) d.LLI[j] |= LLI_SLIP;
+      }
+    }
+  }
 
   /* convert to rtcm messages */
-  if (!ConvertMeasToRtcm(type, m, client_info, &obs, &nav, &sta, staid)) ret = -1;
+  out.reserve(out.size() + kRtcmFrameReserve);
+  int ret = ConvertMeasToRtcm(rtcm, type, m, out, &obs) ? 0 : -1;
+  if (has_phase) SaveSignals(rtcm);
+  return ret;
+}
 
-  free(obs.data);
-  freenav(&nav, 0xFF);
+/* encode rtcm messages into a byte buffer ----------------------------------*/
+int EncodeRtcmMsg(int n, const int *type, int m,
+                  const std::vector<double> &sta_pos,
+                  const std::vector<obsd_t> &data_obs,
+                  std::vector<unsigned char> &out) {
+  RtcmStreamEncoder encoder;
+  return encoder.Encode(n, type, m, sta_pos, data_obs, out);
+}
 
+/* main ----------------------------------------------------------------------*/
+int CreateRtcmMsg(int n, const int *type, int m, SockRTCM *client_info,
+              std::vector<double> sta_pos, std::vector<obsd_t> data_obs) {
+  std::vector<unsigned char> out;
+  int ret = EncodeRtcmMsg(n, type, m, sta_pos, data_obs, out);
+  if (out.empty()) return ret;
+  char client_ip[INET_ADDRSTRLEN];
+  inet_ntop(AF_INET, &(client_info->addr.sin_addr), client_ip, INET_ADDRSTRLEN);
+  int sent = send(client_info->fd, out.data(), out.size(), MSG_NOSIGNAL);
+  if (sent == -1) {
+    *client_info->log << vntimefunc::GetLocalTimeString() << "Client IP: "
+                      << client_ip << ", Port: "
+                      << ntohs(client_info->addr.sin_port)
+                      << " send error: " << strerror(errno) << std::endl;
+    client_info->send_check = false;
+  } else if (sent == 0) {
+    *client_info->log << vntimefunc::GetLocalTimeString() << "client IP: "
+                      << client_ip << ", Port: "
+                      << ntohs(client_info->addr.sin_port)
+                      << " disconnected when sending data " << strerror(errno)
+                      << std::endl;
+  }
   return ret;
 }
 
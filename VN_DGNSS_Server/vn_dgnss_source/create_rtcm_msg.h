@@ -7,6 +7,7 @@
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <vector>
@@ -20,7 +21,54 @@ struct SockRTCM{
   std::ostream *rtcm_log;
 };
 
-// Create RTCM message (modified function from RTKLIB)
+// Bytes reserved for one encoded epoch (1005 + MSM4 of 3 systems)
+static constexpr size_t kRtcmFrameReserve = 2048;
+
+// Encoded RTCM epoch shared read-only by every client it is sent to
+typedef std::shared_ptr<const std::vector<unsigned char>> RtcmFramePtr;
+
+// Encoder of one RTCM stream (a virtual base station), kept across its
+// epochs. It keeps the phase-range ambiguity and lock time of every signal,
+// so the MSM lock-time indicator grows while the phase is continuous; that
+// state is allocated with the first epoch that has phase. The messages are encoded in an rtcm_t (about 570 KB) of the calling thread,
+// allocated and zeroed once per thread rather than once per epoch.
+class RtcmStreamEncoder {
+ public:
+  RtcmStreamEncoder() = default;
+  // Non-copyable
+  RtcmStreamEncoder(const RtcmStreamEncoder &) = delete;
+  RtcmStreamEncoder &operator=(const RtcmStreamEncoder &) = delete;
+  // Encode the next epoch of the stream, as EncodeRtcmMsg
+  int Encode(int n, const int *type, int m, const std::vector<double> &sta_pos,
+             const std::vector<obsd_t> &data_obs,
+             std::vector<unsigned char> &out);
+
+ private:
+  std::vector<obsd_t> data_;
+  // Per signal (satellite x frequency): phase-range ambiguity (m), start of
+  // the lock and last epoch with phase (0 never). Empty until an epoch has
+  // phase.
+  std::vector<double> cp_;
+  std::vector<gtime_t> lltime_;
+  std::vector<uint32_t> last_epoch_;
+  // Epochs encoded
+  uint32_t num_epochs_{};
+  gtime_t last_time_{};
+
+  void MarkSlips();
+  // Copy the state of the signals of the epoch into / out of the rtcm_t
+  void LoadSignals(rtcm_t *rtcm) const;
+  void SaveSignals(const rtcm_t *rtcm);
+};
+
+// Encode RTCM messages into a contiguous byte buffer (appended to out), as
+// the first epoch of a new stream
+int EncodeRtcmMsg(int n, const int *type, int m,
+                  const std::vector<double> &sta_pos,
+                  const std::vector<obsd_t> &data_obs,
+                  std::vector<unsigned char> &out);
+
+// Create RTCM message and send it to the client (modified function from RTKLIB)
 int CreateRtcmMsg(int n, const int *type, int m, SockRTCM *client_info,
               std::vector<double> sta_pos, std::vector<obsd_t> data_obs);
 
@@ -1,11 +1,15 @@
 #include "epoch_generation_helper.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <utility>
 
+#include "async_log.h"
 #include "beidou_code_correction.h"
 #include "ssr_vtec_correction_model.h"
+#include "stage_metrics.h"
+
 static void ReportDatetime(std::ostream &rst, std::vector<double> datetime) {
   rst << std::setfill('0') << std::setw(4) << (int)datetime[0] << " "
       << std::setfill('0') << std::setw(2) << (int)datetime[1] << " "
@@ -27,6 +31,27 @@ static std::string GetSystemTypeStr(int sys) {
   }
 }
 
+static void PrintSkipReason(std::ostream &rst, const SatState &st) {
+  switch (st.skip_reason) {
+    case SatSkipReason::kBdsGeo:
+      rst << " BDS GEO SAT ignored";
+      break;
+    case SatSkipReason::kNoSsrCorr:
+      rst << " No IGS corr";
+      break;
+    case SatSkipReason::kIodMismatch:
+      rst << " IOD not match: " << st.ssr_iod << " EPH_IOD: ";
+      if (st.IODE != -1) rst << st.IODE << " (latest healthy)";
+      break;
+    case SatSkipReason::kEphInvalid:
+      rst << "(" << st.eph_prn << ")"
+          << " sv_H:" << st.eph_svh << " time diff: " << st.eph_tdiff;
+      break;
+    default:
+      break;
+  }
+}
+
 static int SysInforToRtcmCode(int info_code, int sys, int prn) {
   switch (sys) {
     case SYS_GPS: {
@@ -94,90 +119,8 @@ EpochGenerationHelper::EpochGenerationHelper(std::vector<double> pos_ecef)
 
 EpochGenerationHelper::~EpochGenerationHelper() = default;
 
-void EpochGenerationHelper::GetPppCorrections(BkgDataRequestor *foo_bkg,
-                                              WebDataRequestor *foo_web,
-                                              std::ostream &client_log) {
-  // get USTEC ionospheric data
-  ustec_data = foo_web->get_ustec_data();
-  // get clock correction data
-  clock_data = foo_bkg->GetSatClockCorrEpochs();
-  // get orbit correction data
-  orbit_data = foo_bkg->GetSatOrbitCorrEpochs();
-  // get hardware bias
-  code_bias = foo_web->get_code_bias();
-  phase_bias = foo_web->get_phase_bias();
-  code_bias_ssr = foo_bkg->GetSsrCodeBiasCorr();
-  phase_bias_ssr = foo_bkg->GetSsrPhaseBiasCorr();
-  // get ephemeris data
-  eph_data = foo_bkg->GetGnssEphDataEpochs();
-  vtec_ssr = foo_bkg->GetSsrVTecCorr();
-}
-
-// Find orbit data that match the selected PRN.
-bool EpochGenerationHelper::SelectSatOrbitCorrection(std::ostream &rst, int prn,
-                                                     int sys,
-                                                     SatOrbitPara &obt_sv,
-                                                     gtime_t &obt_t) {
-  for (int i = 0; i < 3; i++) {
-    SatOrbitPara obt_elem;
-    gtime_t ssrt_sys;
-    switch (sys) {
-      case SYS_GPS:
-        obt_elem = orbit_data[i].GPS.data_sv[prn];
-        ssrt_sys = orbit_data[i].GPS.time;
-        break;
-      case SYS_GAL:
-        obt_elem = orbit_data[i].GAL.data_sv[prn];
-        ssrt_sys = orbit_data[i].GAL.time;
-        break;
-      case SYS_CMP:
-        obt_elem = orbit_data[i].BDS.data_sv[prn];
-        ssrt_sys = orbit_data[i].BDS.time;
-        break;
-      default:
-        obt_elem.prn = -1;
-    }
-    if (obt_elem.prn != -1 && timediff(gpst_now, ssrt_sys) < 200.0) {
-      obt_sv = obt_elem;
-      obt_t = ssrt_sys;
-      return true;
-    }
-  }
-  // No data matching
-  return false;
-}
-
-bool EpochGenerationHelper::SelectSatClockCorrection(std::ostream &rst, int prn,
-                                                     int sys,
-                                                     SatClockPara &clk_sv,
-                                                     gtime_t &clk_t) {
-  for (int i = 0; i < 3; i++) {
-    SatClockPara clk_elem;
-    gtime_t ssrt_sys;
-    switch (sys) {
-      case SYS_GPS:
-        clk_elem = clock_data[i].GPS.data_sv[prn];
-        ssrt_sys = clock_data[i].GPS.time;
-        break;
-      case SYS_GAL:
-        clk_elem = clock_data[i].GAL.data_sv[prn];
-        ssrt_sys = clock_data[i].GAL.time;
-        break;
-      case SYS_CMP:
-        clk_elem = clock_data[i].BDS.data_sv[prn];
-        ssrt_sys = clock_data[i].BDS.time;
-        break;
-      default:
-        clk_elem.prn = -1;
-    }
-    if (clk_elem.prn != -1 && timediff(gpst_now, ssrt_sys) < 200.0) {
-      clk_sv = clk_elem;
-      clk_t = ssrt_sys;
-      return true;
-    }
-  }
-  // No data matching
-  return false;
+void EpochGenerationHelper::GetPppCorrections(const CorrectionStore &store) {
+  corr = store.Acquire();
 }
 
 // Compute phase wind-up correction
@@ -204,21 +147,42 @@ void EpochGenerationHelper::ResetPhaseWindupVec() {
 }
 
 bool EpochGenerationHelper::ConstructGnssMeas(
-    BkgDataRequestor *foo_bkg, WebDataRequestor *foo_web, std::ostream &rst,
+    const CorrectionStore &store, std::ostream &rst,
     const GnssSystemInfo &infor, const IggtropExperimentModel &TropData,
     int log_count) {
-  vntimefunc::GetGpsTimeNow(date_gps, day_of_year, gpst_now);
+  std::vector<double> date(6, 0);
+  int doy;
+  gtime_t now;
+  vntimefunc::GetGpsTimeNow(date, doy, now);
+  SatStateTable table(store, now, date, doy);
+  return ConstructGnssMeas(table, rst, infor, TropData, log_count);
+}
+
+bool EpochGenerationHelper::ConstructGnssMeas(
+    const SatStateTable &table, std::ostream &rst,
+    const GnssSystemInfo &infor, const IggtropExperimentModel &TropData,
+    int log_count) {
+  uint64_t start_us = vnmetrics::NowUs();
+  gpst_now = table.GetTime();
+  date_gps = table.GetDate();
+  day_of_year = table.GetDayOfYear();
   bool log_out = false;
   if (log_count % 60 == 1) {
     // record log by every 1 minute
     log_out = true;
   }
+  // Per satellite lines, debug level
+  const bool log_sat = VN_LOG_ENABLED(VN_LOG_LEVEL_DEBUG) && log_out;
   if (log_out) {
     rst << "current GPS time: " << date_gps[0] << " " << date_gps[1] << " "
         << date_gps[2] << " " << date_gps[3] << " " << date_gps[4] << " "
         << date_gps[5] << std::endl;
   }
-  GetPppCorrections(foo_bkg, foo_web, rst);
+  corr = table.GetCorrections();
+  corr_version = table.GetCorrVersion();
+  const VTecCorrection &vtec_ssr = corr->vtec_ssr;
+  const BiasCorrData &code_bias = corr->code_bias;
+  const BiasCorrData &phase_bias = corr->phase_bias;
   double tdiff;
   /* Mute USTEC
   gtime_t t_ustec = epoch2time(ustec_data.time);
@@ -246,7 +210,7 @@ bool EpochGenerationHelper::ConstructGnssMeas(
 
   double user_lat, user_lon, user_h = 0;
   /*  Mute USTEC
-  UsTecIonoCorrComputer ido(ustec_data.data, user_pos);
+  UsTecIonoCorrComputer ido(ustec_data.Rows(), user_pos);
   ido.GetLatLonHeight(user_lat, user_lon, user_h);
   */
   // Get LLA (Lat,Lon,H) in rad
@@ -258,27 +222,34 @@ bool EpochGenerationHelper::ConstructGnssMeas(
   // geodetic ellipsoidal separation, compute orthometric height of the receiver
   double Ngeo = geoH.geoidh(user_lat, user_lon);
   user_h = LLA[2] - Ngeo;
+  // Zenith tropospheric delay of the receiver, mapped per satellite
+  uint64_t trop_us = vnmetrics::NowUs();
+  double uLon = user_lon <= 0 ? 2 * PI + user_lon : user_lon;
+  double trop_zenith = TropData.ZenithDelay(user_lat * R2D, uLon * R2D,
+                                            user_h / 1000, day_of_year);
+  trop_us = vnmetrics::NowUs() - trop_us;
+  uint64_t iono_us = 0;
 
   int sys_rtklib = SYS_NONE;
   int max_prn = 0;
   // Initial time gap check
   int t_check = 0;
-  if (timediff(gpst_now, clock_data[0].GPS.time) > 200 ||
-      timediff(gpst_now, orbit_data[0].GPS.time) > 200) {
+  if (timediff(gpst_now, table.GetSsrClockTime(0)) > 200 ||
+      timediff(gpst_now, table.GetSsrOrbitTime(0)) > 200) {
     if (log_out) {
       rst << "GPS SSR data too old (>200s)" << std::endl;
     }
     t_check++;
   }
-  if (timediff(gpst_now, clock_data[0].GAL.time) > 200 ||
-      timediff(gpst_now, orbit_data[0].GAL.time) > 200) {
+  if (timediff(gpst_now, table.GetSsrClockTime(1)) > 200 ||
+      timediff(gpst_now, table.GetSsrOrbitTime(1)) > 200) {
     if (log_out) {
       rst << "GAL SSR data too old (>200s)" << std::endl;
     }
     t_check++;
   }
-  if (timediff(gpst_now, clock_data[0].BDS.time) > 200 ||
-      timediff(gpst_now, orbit_data[0].BDS.time) > 200) {
+  if (timediff(gpst_now, table.GetSsrClockTime(2)) > 200 ||
+      timediff(gpst_now, table.GetSsrOrbitTime(2)) > 200) {
     if (log_out) {
       rst << "BDS SSR data too old (>200s)" << std::endl;
     }
@@ -299,144 +270,72 @@ bool EpochGenerationHelper::ConstructGnssMeas(
   }
   num_sv = 0;
   num_in_sys.resize(3, 0);
+  UsTecIonoCorrComputer ido(corr->ustec_data.Rows(), user_pos);
+  std::vector<double> sat_pos_precise(3, 0);
   for (int sys_i = 0; sys_i < 3; sys_i++) {
     // Checking if the corresponding system requested by client
     if (infor.sys[sys_i] && infor.code_F1[sys_i] != -1) {
-      std::vector<SatBias> cbias_ftp_f1, cbias_ftp_f2;
-      std::vector<SatBias> pbias_ftp_f1, pbias_ftp_f2;
-      CodeBiasCorr cbias_ssr;
-      PhaseBiasCorr pbias_ssr;
-      std::vector<satstruct::Ephemeris> eph_sv[VN_MAX_NUM_OF_EPH_EPOCH];
+      const SatBias *cbias_ftp_f1{}, *cbias_ftp_f2{};
+      const SatBias *pbias_ftp_f1{}, *pbias_ftp_f2{};
       double sys_F1, sys_F2;
       switch (sys_i) {
         case 0:
           sys_rtklib = SYS_GPS;
           max_prn = MAXPRNGPS;
-          cbias_ssr = code_bias_ssr.GPS;
-          pbias_ssr = phase_bias_ssr.GPS;
-          cbias_ftp_f1 = code_bias.bias_GPS[infor.code_F1[sys_i]];
-          cbias_ftp_f2 = code_bias.bias_GPS[infor.code_F2[sys_i]];
-          pbias_ftp_f1 = phase_bias.bias_GPS[infor.code_F1[sys_i]];
-          pbias_ftp_f2 = phase_bias.bias_GPS[infor.code_F2[sys_i]];
-          for (int j = 0; j < VN_MAX_NUM_OF_EPH_EPOCH; j++) {
-            // Copy different version
-            eph_sv[j] = eph_data[j].GPS_eph;
-          }
+          cbias_ftp_f1 = code_bias.bias_GPS[infor.code_F1[sys_i]].data();
+          cbias_ftp_f2 = code_bias.bias_GPS[infor.code_F2[sys_i]].data();
+          pbias_ftp_f1 = phase_bias.bias_GPS[infor.code_F1[sys_i]].data();
+          pbias_ftp_f2 = phase_bias.bias_GPS[infor.code_F2[sys_i]].data();
           sys_F1 = FREQL1;
           sys_F2 = FREQL2;
           break;
         case 1:
           sys_rtklib = SYS_GAL;
           max_prn = MAXPRNGAL;
-          cbias_ssr = code_bias_ssr.GAL;
-          pbias_ssr = phase_bias_ssr.GAL;
-          cbias_ftp_f1 = code_bias.bias_GAL[infor.code_F1[sys_i]];
-          cbias_ftp_f2 = code_bias.bias_GAL[infor.code_F2[sys_i]];
-          pbias_ftp_f1 = phase_bias.bias_GAL[infor.code_F1[sys_i]];
-          pbias_ftp_f2 = phase_bias.bias_GAL[infor.code_F2[sys_i]];
-          for (int j = 0; j < VN_MAX_NUM_OF_EPH_EPOCH; j++) {
-            eph_sv[j] = eph_data[j].GAL_eph;
-          }
+          cbias_ftp_f1 = code_bias.bias_GAL[infor.code_F1[sys_i]].data();
+          cbias_ftp_f2 = code_bias.bias_GAL[infor.code_F2[sys_i]].data();
+          pbias_ftp_f1 = phase_bias.bias_GAL[infor.code_F1[sys_i]].data();
+          pbias_ftp_f2 = phase_bias.bias_GAL[infor.code_F2[sys_i]].data();
           sys_F1 = FREQL1;
           sys_F2 = FREQE5b;
           break;
         case 2:
           sys_rtklib = SYS_CMP;
           max_prn = MAXPRNCMP;
-          cbias_ssr = code_bias_ssr.BDS;
-          pbias_ssr = phase_bias_ssr.BDS;
-          cbias_ftp_f1 = code_bias.bias_BDS[infor.code_F1[sys_i]];
-          cbias_ftp_f2 = code_bias.bias_BDS[infor.code_F2[sys_i]];
-          pbias_ftp_f1 = phase_bias.bias_BDS[infor.code_F1[sys_i]];
-          pbias_ftp_f2 = phase_bias.bias_BDS[infor.code_F2[sys_i]];
-          for (int j = 0; j < VN_MAX_NUM_OF_EPH_EPOCH; j++) {
-            eph_sv[j] = eph_data[j].BDS_eph;
-          }
+          cbias_ftp_f1 = code_bias.bias_BDS[infor.code_F1[sys_i]].data();
+          cbias_ftp_f2 = code_bias.bias_BDS[infor.code_F2[sys_i]].data();
+          pbias_ftp_f1 = phase_bias.bias_BDS[infor.code_F1[sys_i]].data();
+          pbias_ftp_f2 = phase_bias.bias_BDS[infor.code_F2[sys_i]].data();
           sys_F1 = FREQ1_CMP;
           sys_F2 = FREQ2_CMP;
           break;
       }
-      SatClockPara clk_sv;
-      SatOrbitPara obt_sv;
-      gtime_t t_clk{}, t_obt{};
+      const std::vector<SatState> &states = table.GetSatStates(sys_i);
       for (int prn = 1; prn < max_prn + 1; prn++) {
-        if (sys_i == 2) {
-          if (prn <= 5 || prn == 18 || prn >= 59) {
-            if (log_out) {
-              rst << GetSystemTypeStr(sys_rtklib) << prn
-                  << " BDS GEO SAT ignored" << std::endl;
-            }
-            phase_windup_track[sys_i][prn] = 0;
-            continue;
-          }
-        }
-        // Pick SSR clock and orbit correction, check the latency
-        if (!(SelectSatOrbitCorrection(rst, prn, sys_rtklib, obt_sv, t_obt) &&
-              SelectSatClockCorrection(rst, prn, sys_rtklib, clk_sv, t_clk))) {
-          if (log_out) {
-            rst << GetSystemTypeStr(sys_rtklib) << prn << " No IGS corr"
-                << std::endl;
+        const SatState &st = states[prn];
+        if (!st.valid) {
+          if (log_sat) {
+            rst << GetSystemTypeStr(sys_rtklib) << prn;
+            PrintSkipReason(rst, st);
+            rst << std::endl;
           }
           phase_windup_track[sys_i][prn] = 0;
           continue;
         }
         // Check if code bias is available from GIPP product
         if (cbias_ftp_f1[prn].prn == -1) {
-          if (log_out) {
+          if (log_sat) {
             rst << GetSystemTypeStr(sys_rtklib) << prn
                 << " No code bias corr for freq 1 from GIPP" << std::endl;
           }
           phase_windup_track[sys_i][prn] = 0;
           continue;
         }
-        int ver = -1;
-        for (int j = 0; j < VN_MAX_NUM_OF_EPH_EPOCH; j++) {
-          // Checking for different eph version
-          if (obt_sv.IOD == eph_sv[j][prn].IODE && eph_sv[j][prn].prn != -1) {
-            ver = j;
-            break;
-          }
-        }
-        if (ver == -1) {
-          if (log_out) {
-            rst << GetSystemTypeStr(sys_rtklib) << prn
-                << " IOD not match: " << obt_sv.IOD << " EPH_IOD: ";
-            for (int j = 0; j < 6; j++) {
-              rst << eph_sv[j][prn].IODE << " ";
-            }
-            rst << std::endl;
-          }
-          phase_windup_track[sys_i][prn] = 0;
-          continue;
-        }
-        double eph_tdiff = timediff(gpst_now, eph_sv[ver][prn].t_oc);
-        double ep[6];
-        time2epoch(eph_sv[ver][prn].t_oc, ep);
-
-        if (std::abs(eph_tdiff) > 7200.0 + 120.0 || eph_sv[ver][prn].svH != 0 ||
-            eph_sv[ver][prn].prn == -1) {
-          if (log_out) {
-            rst << GetSystemTypeStr(sys_rtklib) << prn << "("
-                << eph_sv[ver][prn].prn << ")"
-                << " sv_H:" << eph_sv[ver][prn].svH
-                << " time diff: " << eph_tdiff << std::endl;
-          }
-          phase_windup_track[sys_i][prn] = 0;
-          continue;
-        }
-        SatPosClkComputer spco(gpst_now, obt_sv.dx_m, obt_sv.dv_m, t_obt,
-                               clk_sv.dt_corr_s, t_clk, eph_sv[ver][prn],
-                               sys_rtklib);
-        // compute propagation time using optimization function
-        spco.PropTimeOptm(user_pos);
-        // Rotate satellite position
-        spco.ComputePreciseOrbitClockCorrection();
-        // get precise satellite position
-        std::vector<double> sat_pos_precise = spco.GetPreciseSatPos();
-        // get precise satellite position at its transmit time
-        std::vector<double> sat_pos_pretrans = spco.GetPreSatPosAtTranst();
-        // get precise satellite clock bias
-        double delt_sv = spco.GetClock();
+        // solve the light time from the cached satellite state, get the
+        // precise satellite position (rotated) and clock bias
+        double delt_sv;
+        SatStateTable::SolveLightTime(st, sys_rtklib, user_pos,
+                                      sat_pos_precise.data(), delt_sv);
         std::vector<double> range_vector(3, 0);
         for (int j = 0; j < 3; j++) {
           range_vector[j] = user_pos[j] - sat_pos_precise[j];
@@ -445,12 +344,11 @@ bool EpochGenerationHelper::ConstructGnssMeas(
             sqrt(pow(range_vector[0], 2) + pow(range_vector[1], 2) +
                  pow(range_vector[2], 2));
 
-        UsTecIonoCorrComputer ido(ustec_data.data, user_pos);
         std::vector<double> elaz =
             ido.ElevationAzimuthComputation(sat_pos_precise);
         double user_elev = elaz[0];
         if (user_elev <= ELEVMASK) {
-          if (log_out) {
+          if (log_sat) {
             rst << GetSystemTypeStr(sys_rtklib) << prn << " elev: " << user_elev
                 << std::endl;
           }
@@ -459,18 +357,20 @@ bool EpochGenerationHelper::ConstructGnssMeas(
         }
 
         // compute ionospheric delay from SSR
+        uint64_t stage_us = vnmetrics::NowUs();
         double iono_delay_L1 = 0, iono_delay_L2 = 0;
         SsrVtecCorrectionModel VTEC;
-        iono_delay_L1 = VTEC.stec(vtec_ssr, gpst_now.sec, user_pos,
-                                  sat_pos_precise, sys_F1);
+        iono_delay_L1 = VTEC.stec(table.GetVtecEvaluator(), gpst_now.sec,
+                                  user_pos, sat_pos_precise, sys_F1);
         iono_delay_L2 = iono_delay_L1 * (sys_F1 * sys_F1 / (sys_F2 * sys_F2));
 
+        uint64_t split_us = vnmetrics::NowUs();
+        iono_us += split_us - stage_us;
+
         // compute Tropospheric delay
-        IggtropCorrectionModel IGG;
-        double uLon = user_lon <= 0 ? 2 * PI + user_lon : user_lon;
         double trop_IGG =
-            IGG.IGGtropdelay(uLon * R2D, user_lat * R2D, user_h / 1000,
-                             day_of_year, user_elev, TropData.data);
+            IggtropCorrectionModel::MappingFactor(user_elev) * trop_zenith;
+        trop_us += vnmetrics::NowUs() - split_us;
 
         // COmpute Beidou code correction
         double bds_corr = 0;
@@ -494,10 +394,10 @@ bool EpochGenerationHelper::ConstructGnssMeas(
           rst << "sat prc pos rotated: " << std::setprecision(13) << " "
               << sat_pos_precise[0] << " " << sat_pos_precise[1] << " "
               << sat_pos_precise[2] << std::endl;
-          rst << "dx[0] ,dv[0],dt_corr[0]: " << obt_sv.dx_m[0] << " "
-              << obt_sv.dv_m[0] << clk_sv.dt_corr_s[0] << std::endl;
-          rst << "timediff now to ssr: " << timediff(gpst_now, t_obt) << " "
-              << timediff(gpst_now, t_clk) << std::endl;
+          rst << "dx[0] ,dv[0],dt_corr[0]: " << st.dx0 << " " << st.dv0
+              << st.dt0 << std::endl;
+          rst << "timediff now to ssr: " << timediff(gpst_now, st.t_obt) << " "
+              << timediff(gpst_now, st.t_clk) << std::endl;
         }
 
         data[num_sv].sat = satno(sys_rtklib, prn);
@@ -548,7 +448,7 @@ bool EpochGenerationHelper::ConstructGnssMeas(
               SysInforToRtcmCode(infor.code_F2[sys_i], sys_rtklib, prn);
           data[num_sv].SNR[1] = data[num_sv].SNR[0];
         }
-        if (log_out) {
+        if (log_sat) {
           //          rst << " L2 code-phase = " << std::setprecision(5)
           //              << data[num_sv].P[1] - data[num_sv].L[1] * (CLIGHT /
           //              sys_F2)
@@ -556,8 +456,8 @@ bool EpochGenerationHelper::ConstructGnssMeas(
           //              pbias_ftp_f2[prn].value * 1e-9
           //              << std::endl;
           rst << GetSystemTypeStr(sys_rtklib) << prn
-              << " Eph_diff: " << std::setprecision(5) << eph_tdiff << " IODE "
-              << eph_sv[ver][prn].IODE << " L1 code: "
+              << " Eph_diff: " << std::setprecision(5) << st.eph_tdiff
+              << " IODE " << st.IODE << " L1 code: "
               << std::setprecision(12)
               // << data[num_sv].P[0] << " L1 phase: " << std::setprecision(12)
               // << data[num_sv].L[0] << " L2 code: " << std::setprecision(12)
@@ -576,6 +476,11 @@ bool EpochGenerationHelper::ConstructGnssMeas(
       rst << infor.sys[sys_i] << " " << infor.code_F1[sys_i] << std::endl;
     }
   }
+  uint64_t total_us = vnmetrics::NowUs() - start_us;
+  vnmetrics::RecordStage(vnmetrics::kIono, iono_us);
+  vnmetrics::RecordStage(vnmetrics::kTrop, trop_us);
+  vnmetrics::RecordStage(vnmetrics::kSatellites,
+                         total_us - std::min(total_us, iono_us + trop_us));
   if (num_sv > 3) {
     if (log_out) {
       rst << "GPS: " << num_in_sys[0] << " GAL: " << num_in_sys[1]
@@ -590,20 +495,37 @@ bool EpochGenerationHelper::ConstructGnssMeas(
   }
 }
 
+int EpochGenerationHelper::GetRtcmMsgTypes(int *type) const {
+  int m = 1; /*Number of OBS message type*/
+  type[0] = 1005;
+  if (num_in_sys[0] > 0) {
+    type[m++] = 1074; /* GPS massage type */
+  }
+  if (num_in_sys[1] > 0) {
+    type[m++] = 1094; /* GAL massage type */
+  }
+  if (num_in_sys[2] > 0) {
+    type[m++] = 1124; /* BDS massage type */
+  }
+  return m;
+}
+
 void EpochGenerationHelper::SendRtcmMsgToClient(SockRTCM *client_info) {
   if (num_sv > 3) {
     int type[16];
-    int m = 1; /*Number of OBS message type*/
-    type[0] = 1005;
-    if (num_in_sys[0] > 0) {
-      type[m++] = 1074; /* GPS massage type */
-    }
-    if (num_in_sys[1] > 0) {
-      type[m++] = 1094; /* GAL massage type */
-    }
-    if (num_in_sys[2] > 0) {
-      type[m++] = 1124; /* BDS massage type */
-    }
+    int m = GetRtcmMsgTypes(type);
     CreateRtcmMsg(num_sv, type, m, client_info, user_pos, data);
   }
 }
+
+bool EpochGenerationHelper::EncodeRtcmMsg(RtcmStreamEncoder &encoder,
+                                          std::vector<unsigned char> &frame) {
+  if (num_sv <= 3) return false;
+  int type[16];
+  int m = GetRtcmMsgTypes(type);
+  uint64_t start_us = vnmetrics::NowUs();
+  bool ok = encoder.Encode(num_sv, type, m, user_pos, data, frame) == 0 &&
+            !frame.empty();
+  vnmetrics::RecordStage(vnmetrics::kEncode, vnmetrics::NowUs() - start_us);
+  return ok;
+}
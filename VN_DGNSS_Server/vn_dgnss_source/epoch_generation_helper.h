@@ -1,10 +1,12 @@
 #pragma once
 #include "bkg_data_requestor.h"
+#include "correction_snapshot.h"
 #include "create_rtcm_msg.h"
 #include "geoid_model_helper.h"
 #include "iggtrop_correction_model.h"
 #include "rtklib.h"
 #include "sat_pos_clk_computer.h"
+#include "sat_state_table.h"
 #include "time_common_func.h"
 #include "us_tec_iono_corr_computer.h"
 #include "web_data_requestor.h"
@@ -25,18 +27,27 @@ struct GnssSystemInfo {
 class EpochGenerationHelper {
  public:
   explicit EpochGenerationHelper(std::vector<double> pos_ecef);
-  void GetPppCorrections(BkgDataRequestor *foo_bkg, WebDataRequestor *foo_web, std::ostream &client_log);
-  bool ConstructGnssMeas(BkgDataRequestor *foo_bkg, WebDataRequestor *foo_web,
+  void GetPppCorrections(const CorrectionStore &store);
+  bool ConstructGnssMeas(const CorrectionStore &store,
                           std::ostream &rst, const GnssSystemInfo & infor,
                           const IggtropExperimentModel & TropData,
                           int log_count);
+  // Generate the epoch from satellite states shared with other receivers
+  bool ConstructGnssMeas(const SatStateTable &table, std::ostream &rst,
+                         const GnssSystemInfo &infor,
+                         const IggtropExperimentModel &TropData,
+                         int log_count);
   void ComputePhaseWindup(int sys_i, int prn_idx, const std::vector<double> &sat_pos_pretrans);
   void ResetPhaseWindupVec();
-  bool SelectSatOrbitCorrection(std::ostream &rst,int prn, int sys,
-                  SatOrbitPara &obt_sv, gtime_t &obt_t);
-  bool SelectSatClockCorrection(std::ostream &rst,int prn, int sys,
-                  SatClockPara &clk_sv, gtime_t &clk_t);
   void SendRtcmMsgToClient(SockRTCM *client_info);
+  // Encode the generated epoch (1005 + MSM4) into a byte buffer, as the
+  // next epoch of the stream of encoder
+  bool EncodeRtcmMsg(RtcmStreamEncoder &encoder,
+                     std::vector<unsigned char> &frame);
+  gtime_t GetEpochTime() const { return gpst_now; }
+  uint64_t GetCorrVersion() const { return corr_version; }
+  int GetNumOfSat() const { return num_sv; }
+  const std::vector<obsd_t> &GetObservations() const { return data; }
   ~EpochGenerationHelper();
 
  private:
@@ -44,17 +55,13 @@ class EpochGenerationHelper {
   int num_sv{};  // Number of satellites available
   std::vector<int> num_in_sys{};
   const std::vector<double> user_pos;  // User position in ECEF (ITRF 2014)
-  UsTecCorrData ustec_data;
-  VTecCorrection vtec_ssr;
-  std::vector<SsrClockCorrEpoch> clock_data;
-  std::vector<SsrOrbitCorrEpoch> orbit_data;
-  BiasCorrData code_bias;
-  BiasCorrData phase_bias;
-  SsrCodeBiasEpoch code_bias_ssr;
-  SsrPhaseBiasEpoch phase_bias_ssr;
+  // Corrections of this epoch, shared with the other clients
+  std::shared_ptr<const CorrectionSnapshot> corr;
+  uint64_t corr_version{};
   std::vector<std::vector<double>> phase_windup_track;
-  std::vector<GnssEphStruct> eph_data;
   gtime_t gpst_now{};
   int day_of_year{};
   std::vector<double> date_gps;
+
+  int GetRtcmMsgTypes(int *type) const;
 };
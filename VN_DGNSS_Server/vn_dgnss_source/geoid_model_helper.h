@@ -1,13 +1,14 @@
 #pragma once
+#include "mapped_model_file.h"
 #include "sat_pos_clk_computer.h"
 
 class GeoidModelHelper {
 public:
+    // Map the geoid grid (.vnm, [lon][lat]) shared by all the helpers
+    static bool LoadModel(const std::string &path);
     double geoidh(double geo_lat,double geo_lon);
     
 private:
     double interpb(double *y, double a, double d);
-    static const double range[];
-    static const float geoidval[361][181];
+    static MappedModelFile model;
 };
-
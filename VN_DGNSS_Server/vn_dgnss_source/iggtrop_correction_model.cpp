@@ -1,6 +1,11 @@
 #include "iggtrop_correction_model.h"
 
-int IggtropCorrectionModel::fix(double val) {
+#include <cstring>
+#include <vector>
+
+#include "time_common_func.h"
+
+static int fix(double val) {
   if (val>=0) {
     return floor(val);
   } else {
@@ -9,86 +14,98 @@ int IggtropCorrectionModel::fix(double val) {
 }
 
 IggtropExperimentModel GetIggtropCorrDataFromFile(const std::string& file) {
-  int nHPara = 6;
-  int nPara = 5;
-  double dlon = 2.5, dlat = 2.5;
-  int nLon = 144; int nLat = 73;
-  std::vector<float> data;
-  std::vector<float> dataread(nHPara*nPara*nLat*nLon,0);
-  std::ifstream inFile(file,std::ios::in|std::ios::binary);
-  while(inFile.read((char *)dataread.data(), dataread.size())) {
-    data.insert(data.end(),dataread.begin(),dataread.begin()+78840);
-  }
-  inFile.close();
+  using M = IggtropExperimentModel;
+  const uint32_t dims[3] = {M::kNumLat, M::kNumLon, M::kNodeStride};
   IggtropExperimentModel TropModel;
-  TropModel.data.resize(nPara);
-  for (int n1 = 0; n1 < nPara;n1++) {
-    TropModel.data[n1].resize(nHPara);
-    for (int n2 = 0; n2 < nHPara; n2++) {
-      TropModel.data[n1][n2].resize(nLat);
+  std::ifstream inFile(file,std::ios::in|std::ios::binary);
+  char magic[sizeof(MappedModelFile::kMagic)] = {};
+  inFile.read(magic, sizeof(magic));
+  if (memcmp(magic, MappedModelFile::kMagic, sizeof(magic)) == 0) {
+    inFile.close();
+    if (TropModel.file.Open(file) && !TropModel.file.HasDims(3, dims)) {
+      std::cout << vntimefunc::GetLocalTimeString()
+                << " IGGtrop model " << file << " has wrong dims" << std::endl;
+      TropModel.file.Close();
     }
+    return TropModel;
+  }
+  // .ztd layout is [para][hpara][lat][lon], read it at once
+  const size_t count = (size_t)M::kNumPara * M::kNumHPara * M::kNumLat *
+                       M::kNumLon;
+  std::vector<float> raw(count);
+  inFile.seekg(0);
+  if (!inFile.read((char *)raw.data(), count * sizeof(float))) {
+    std::cout << vntimefunc::GetLocalTimeString()
+              << " Failed to read IGGtrop model " << file << std::endl;
+    return TropModel;
   }
-  // Reshape
-  int cout=0;
-  for (int n1 = 0; n1 < nPara;n1++) {
-    for (int n2 = 0; n2 < nHPara; n2++) {
-      for (int n3 = 0; n3 < nLat; n3++) {
-        TropModel.data[n1][n2][n3].insert(TropModel.data[n1][n2][n3].end(),
-                                          data.begin()+cout,
-                                          data.begin()+144+cout);
-        cout += 144;
+  inFile.close();
+  MappedModelHeader header{};
+  header.num_dims = 3;
+  for (int i = 0; i < 3; i++) header.dims[i] = dims[i];
+  header.origin[0] = 90.0f;
+  header.spacing[0] = -2.5f;
+  header.spacing[1] = 2.5f;
+  header.spacing[2] = 1.0f;
+  if (!TropModel.file.Create(header)) return TropModel;
+  float *grid = TropModel.file.MutableData();
+  // Transpose to [lat][lon][para][hpara]
+  const float *src = raw.data();
+  for (int n1 = 0; n1 < M::kNumPara; n1++) {
+    for (int n2 = 0; n2 < M::kNumHPara; n2++) {
+      for (int n3 = 0; n3 < M::kNumLat; n3++) {
+        for (int n4 = 0; n4 < M::kNumLon; n4++) {
+          grid[(n3 * M::kNumLon + n4) * M::kNodeStride + n1 * M::kNumHPara +
+               n2] = *src++;
+        }
       }
     }
   }
   return TropModel;
 }
-double IggtropCorrectionModel::IGGtropdelay(
-    double uLon, double uLat, double uH, int doy, double elev,
-    const std::vector<std::vector<std::vector<std::vector<float>>>> &data) {
-  int nHPara = 6;
-  int nPara = 5;
-  double dlon = 2.5, dlat = 2.5;
-  int nLon = 144; int nLat = 73;
-  double ix = (uLon - 0.0)/2.5+1;
-  double iy = -(uLat - 90)/2.5+1;
 
-  std::vector<double> Ygrid(4,0);
-  double bit[4] = {0,1,0,1};
+double IggtropExperimentModel::ZenithDelay(double lat, double lon, double h,
+                                           int doy) const {
+  double ix = (lon - 0.0)/2.5+1;
+  double iy = -(lat - 90)/2.5+1;
+  // Powers of the height, shared by the 4 corners
+  double hk[kNumHPara];
+  hk[0] = 1;
+  for (int k = 1; k < kNumHPara; k++) hk[k] = hk[k - 1] * h;
+  double t = 2*PI*doy/365.25;
+  double ct = cos(t), st = sin(t), c2t = cos(2 * t), s2t = sin(2 * t);
+
+  double Ygrid[4];
+  const int bit[4] = {0,1,0,1};
   for (int i = 0; i<4; i++) {
-    int a = (fix(ix+bit[i])-1)%nLon+1;
-    int b = fix(iy) + fix(i/2);
-    if (b>nLat) {
-      b = nLat;
-    }
-    std::vector<std::vector<float>> a_coe;
-    a_coe.resize(nPara);
-    for (int n1 = 0; n1 < nPara;n1++) {
-      a_coe[n1].resize(nHPara);
-    }
-    for (int n1 = 0; n1 < nPara;n1++) {
-      for (int n2 = 0; n2 < nHPara; n2++) {
-        a_coe[n1][n2] = data[n1][n2][fix(b) - 1][fix(a) - 1];
-      }
+    int a = (fix(ix+bit[i])-1)%kNumLon+1;
+    int b = fix(iy) + i/2;
+    if (b>kNumLat) {
+      b = kNumLat;
     }
+    const float *c = Node(b - 1, a - 1);
     double ab1 = 0;
-    for (int k = 1; k < nHPara-1; k++) {
-      ab1 += a_coe[0][k]*pow(uH,k);
+    for (int k = 1; k < kNumHPara-1; k++) {
+      ab1 += c[k]*hk[k];
     }
-    double ave = a_coe[0][0]*exp(ab1)+a_coe[0][nHPara-1];
-
-    double ab2 = 0;
-    std::vector<double> A(nPara-1,0);
-    for (int n = 0; n < nPara-1;n++) {
-      for (int k=0;k<nHPara;k++){
-        A[n] += a_coe[n+1][k]*pow(uH,k);
+    double ave = c[0]*exp(ab1)+c[kNumHPara-1];
+    double A[kNumPara-1];
+    for (int n = 0; n < kNumPara-1;n++) {
+      const float *cn = c + (n + 1) * kNumHPara;
+      A[n] = 0;
+      for (int k=0;k<kNumHPara;k++){
+        A[n] += cn[k]*hk[k];
       }
     }
-    double t = 2*PI*doy/365.25;
-    Ygrid[i] = ave+A[0]*cos(t)+A[1]*sin(t)+A[2]*cos(2*t)+A[3]*sin(2*t);
+    Ygrid[i] = ave+A[0]*ct+A[1]*st+A[2]*c2t+A[3]*s2t;
   }
   double p = ix - fix(ix);
   double q = iy - fix(iy);
-  double ZTD = (1-p)*(1-q)*Ygrid[0]+(1-q)*p*Ygrid[1]+(1-p)*q*Ygrid[2]+p*q*Ygrid[3];
-  double Trop = (1.001/sqrt(0.002001+sin(elev)*sin(elev)))*ZTD;
-  return Trop;
+  return (1-p)*(1-q)*Ygrid[0]+(1-q)*p*Ygrid[1]+(1-p)*q*Ygrid[2]+p*q*Ygrid[3];
+}
+
+double IggtropCorrectionModel::IGGtropdelay(
+    double uLon, double uLat, double uH, int doy, double elev,
+    const IggtropExperimentModel &model) {
+  return MappingFactor(elev) * model.ZenithDelay(uLat, uLon, uH, doy);
 }
@@ -2,21 +2,44 @@
 #define VN_DGNSS_SERVER_IGGTROP_CORRECTION_MODEL_H
 
 #pragma once
+#include "mapped_model_file.h"
 #include "sat_pos_clk_computer.h"
 #include <fstream>
 
+// IGGtrop zenith delay grid, 2.5 x 2.5 deg. The coefficients of a grid node
+// are contiguous so the 4 corners of a lookup touch 4 cache line pairs.
 struct IggtropExperimentModel {
-  std::vector<std::vector<std::vector<std::vector<float>>>> data;
+  static constexpr int kNumLat = 73;
+  static constexpr int kNumLon = 144;
+  static constexpr int kNumPara = 5;
+  static constexpr int kNumHPara = 6;
+  // Floats per grid node, kNumPara * kNumHPara padded to 128 bytes
+  static constexpr int kNodeStride = 32;
+
+  // [lat][lon][para][hpara] grid, mapped from a .vnm file or converted from
+  // a .ztd file
+  MappedModelFile file;
+
+  bool IsLoaded() const { return file.IsOpen(); }
+  // Coefficients of a grid node, indexed [para * kNumHPara + hpara]
+  const float *Node(int lat_idx, int lon_idx) const {
+    return file.Data() + (lat_idx * kNumLon + lon_idx) * kNodeStride;
+  }
+  // Zenith total delay (m). lat/lon in deg (lon in [0, 360)), h in km.
+  double ZenithDelay(double lat, double lon, double h, int doy) const;
 };
+// Load the model from a .vnm file, or from the original .ztd file
 IggtropExperimentModel GetIggtropCorrDataFromFile(const std::string& file);
 
 class IggtropCorrectionModel {
 public:
-  double IGGtropdelay(
-      double uLon,double uLat,double uH,int doy, double elev,
-      const std::vector<std::vector<std::vector<std::vector<float>>>>& data);
-private:
-  static int fix(double val);
+  // Elevation mapping of the zenith delay
+  static double MappingFactor(double elev) {
+    double s = sin(elev);
+    return 1.001 / sqrt(0.002001 + s * s);
+  }
+  double IGGtropdelay(double uLon, double uLat, double uH, int doy,
+                      double elev, const IggtropExperimentModel &model);
 };
 
 #endif // VN_DGNSS_SERVER_IGGTROP_CORRECTION_MODEL_H
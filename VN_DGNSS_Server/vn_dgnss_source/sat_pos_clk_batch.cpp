@@ -0,0 +1,182 @@
+#include "sat_pos_clk_batch.h"
+
+#include <cmath>
+
+#include "sat_pos_clk_computer.h"
+
+SatPosClkBatch::SatPosClkBatch(int sys)
+    : sys_(sys), omge_(OMGE_define(sys)), mu_(MU_define(sys)),
+      f_(F_define(sys)) {}
+
+int SatPosClkBatch::Add(int prn, const satstruct::Ephemeris &eph,
+                        const SatOrbitPara &obt_sv, gtime_t t_obt,
+                        const SatClockPara &clk_sv, gtime_t t_clk) {
+  if (n_ >= kMaxSat) return -1;
+  int i = n_++;
+  prn_[i] = prn;
+  geo_[i] = sys_ == SYS_CMP && (eph.prn <= 5 || eph.prn == 18);
+  t_oc_[i] = eph.t_oc;
+  t_oe_[i] = eph.t_oe;
+  t_obt_[i] = t_obt;
+  t_clk_[i] = t_clk;
+  toes_[i] = eph.toes;
+  a_f0_[i] = eph.a_f0;
+  a_f1_[i] = eph.a_f1;
+  a_f2_[i] = eph.a_f2;
+  M_0_[i] = eph.M_0;
+  e_[i] = eph.e;
+  Delta_n_[i] = eph.Delta_n;
+  sqrtA_[i] = eph.sqrtA;
+  Omega_0_[i] = eph.Omega_0;
+  i_0_[i] = eph.i_0;
+  omega_[i] = eph.omega;
+  OmegaDot_[i] = eph.OmegaDot;
+  IDOT_[i] = eph.IDOT;
+  C_uc_[i] = eph.C_uc;
+  C_us_[i] = eph.C_us;
+  C_rc_[i] = eph.C_rc;
+  C_rs_[i] = eph.C_rs;
+  C_ic_[i] = eph.C_ic;
+  C_is_[i] = eph.C_is;
+  for (int k = 0; k < 3; k++) {
+    dx_[k][i] = obt_sv.dx_m[k];
+    dv_[k][i] = obt_sv.dv_m[k];
+    dt_corr_[k][i] = clk_sv.dt_corr_s[k];
+  }
+  return i;
+}
+
+void SatPosClkBatch::EphPosVel(double *sEk_out) {
+  for (int i = 0; i < n_; i++) {
+    double e = e_[i];
+    double A = sqrtA_[i] * sqrtA_[i];
+    double t_k = t_k_[i];
+    double n = sqrt(mu_ / (A * A * A)) + Delta_n_[i];
+    double M_k = M_0_[i] + n * t_k;
+    double E_k = M_k;
+    for (int it = 0; it < kKeplerIter; it++) {
+      E_k -= (E_k - e * sin(E_k) - M_k) / (1 - e * cos(E_k));
+    }
+    double sEk = sin(E_k), cEk = cos(E_k);
+    sEk_out[i] = sEk;
+
+    double v_k = atan2((sqrt(1 - e * e) * sEk) / (1 - e * cEk),
+                       (cEk - e) / (1 - e * cEk));
+    double cvk = cos(v_k), svk = sin(v_k);
+    double Phi_k = v_k + omega_[i];
+    double s2Phik = sin(2 * Phi_k), c2Phik = cos(2 * Phi_k);
+    double u_k = Phi_k + C_us_[i] * s2Phik + C_uc_[i] * c2Phik;
+    double r_k = A * (1 - e * cEk) + C_rs_[i] * s2Phik + C_rc_[i] * c2Phik;
+    double i_k = i_0_[i] + C_is_[i] * s2Phik + C_ic_[i] * c2Phik +
+                 IDOT_[i] * t_k;
+    double cuk = cos(u_k), suk = sin(u_k);
+    double c2uk = cos(2 * u_k), s2uk = sin(2 * u_k);
+    double cik = cos(i_k), sik = sin(i_k);
+    double x_k_prime = r_k * cuk;
+    double y_k_prime = r_k * suk;
+
+    double sOmeg, cOmeg;
+    if (geo_[i]) {
+      // BeiDou GEO
+      double Omega_k = Omega_0_[i] + OmegaDot_[i] * t_k - omge_ * toes_[i];
+      sOmeg = sin(Omega_k);
+      cOmeg = cos(Omega_k);
+      double xg = x_k_prime * cOmeg - y_k_prime * cik * sOmeg;
+      double yg = x_k_prime * sOmeg + y_k_prime * cik * cOmeg;
+      double zg = y_k_prime * sik;
+      double sino = sin(omge_ * t_k);
+      double coso = cos(omge_ * t_k);
+      pos_[0][i] = xg * coso + yg * sino * COS_5 + zg * sino * SIN_5;
+      pos_[1][i] = -xg * sino + yg * coso * COS_5 + zg * coso * SIN_5;
+      pos_[2][i] = -yg * SIN_5 + zg * COS_5;
+    } else {
+      double Omega_k = Omega_0_[i] + (OmegaDot_[i] - omge_) * t_k -
+                       omge_ * toes_[i];
+      sOmeg = sin(Omega_k);
+      cOmeg = cos(Omega_k);
+      pos_[0][i] = x_k_prime * cOmeg - y_k_prime * cik * sOmeg;
+      pos_[1][i] = x_k_prime * sOmeg + y_k_prime * cik * cOmeg;
+      pos_[2][i] = y_k_prime * sik;
+    }
+
+    // Velocity (Remondi)
+    double Edot_k = n / (1 - e * cEk);
+    double vdot_k = sEk * Edot_k * (1 + e * cvk) / (svk * (1 - e * cEk));
+    double udot_k = vdot_k + 2 * (C_us_[i] * c2uk - C_uc_[i] * s2uk) * vdot_k;
+    double rdot_k = A * e * sEk * n / (1 - e * cEk) +
+                    2 * (C_rs_[i] * c2uk - C_rc_[i] * s2uk) * vdot_k;
+    double idot_k =
+        IDOT_[i] + (C_is_[i] * c2uk - C_ic_[i] * s2uk) * 2 * vdot_k;
+    double xdot_k_prime = rdot_k * cuk - y_k_prime * udot_k;
+    double ydot_k_prime = rdot_k * sik + x_k_prime * udot_k;
+    double OmegaDot_k = OmegaDot_[i] - omge_;
+    double a = xdot_k_prime - y_k_prime * cik * OmegaDot_k;
+    double b = x_k_prime * OmegaDot_k + ydot_k_prime * cik -
+               y_k_prime * sik * idot_k;
+    vel_[0][i] = a * cOmeg - b * sOmeg;
+    vel_[1][i] = a * sOmeg + b * cOmeg;
+    vel_[2][i] = ydot_k_prime * sik + y_k_prime * cik * idot_k;
+  }
+}
+
+void SatPosClkBatch::SetReceiveTime(gtime_t rcv_t) {
+  for (int i = 0; i < n_; i++) {
+    dt_oc_[i] = timediff(rcv_t, t_oc_[i]);
+    dt_oe_[i] = timediff(rcv_t, t_oe_[i]);
+    dt_obt_[i] = timediff(rcv_t, t_obt_[i]);
+    dt_clk_[i] = timediff(rcv_t, t_clk_[i]);
+  }
+}
+
+void SatPosClkBatch::EvalPrecise() {
+  // Broadcast and SSR clock at rcv_t - tp, then transmit time
+  for (int i = 0; i < n_; i++) {
+    double t = dt_oc_[i] - tp_[i];
+    double dt_clk = a_f0_[i] + a_f1_[i] * t + a_f2_[i] * t * t;
+    double dt_p = dt_clk_[i] - tp_[i];
+    double dt_clk_precise = (dt_corr_[0][i] + dt_corr_[1][i] * dt_p +
+                             dt_corr_[2][i] * dt_p * dt_p) /
+                            CLIGHT;
+    t_k_[i] = dt_oe_[i] - tp_[i] - dt_clk;
+    t_orb_[i] = dt_obt_[i] - tp_[i] - dt_clk;
+    clk_[i] = dt_clk + dt_clk_precise;
+  }
+  double sEk[kMaxSat];
+  EphPosVel(sEk);
+  for (int i = 0; i < n_; i++) {
+    double vx = vel_[0][i], vy = vel_[1][i], vz = vel_[2][i];
+    double px = pos_[0][i], py = pos_[1][i], pz = pos_[2][i];
+    prc_clk_[i] = clk_[i] + f_ * e_[i] * sqrtA_[i] * sEk[i];
+    // SSR orbit correction, RAC to ECEF
+    double dr = dx_[0][i] + dv_[0][i] * t_orb_[i];
+    double da = dx_[1][i] + dv_[1][i] * t_orb_[i];
+    double dc = dx_[2][i] + dv_[2][i] * t_orb_[i];
+    double norm_v = sqrt(vx * vx + vy * vy + vz * vz);
+    double ax = vx / norm_v, ay = vy / norm_v, az = vz / norm_v;
+    double cx = py * vz - pz * vy, cy = pz * vx - px * vz,
+           cz = px * vy - py * vx;
+    double norm_c = sqrt(cx * cx + cy * cy + cz * cz);
+    cx /= norm_c;
+    cy /= norm_c;
+    cz /= norm_c;
+    double rx = ay * cz - az * cy, ry = az * cx - ax * cz,
+           rz = ax * cy - ay * cx;
+    prc_[0][i] = px - (rx * dr + ax * da + cx * dc);
+    prc_[1][i] = py - (ry * dr + ay * da + cy * dc);
+    prc_[2][i] = pz - (rz * dr + az * da + cz * dc);
+  }
+}
+
+void SatPosClkBatch::ComputeAtPropTime(gtime_t rcv_t, double tp) {
+  SetReceiveTime(rcv_t);
+  for (int i = 0; i < n_; i++) tp_[i] = tp;
+  EvalPrecise();
+  for (int i = 0; i < n_; i++) {
+    for (int k = 0; k < 3; k++) pos_prc_[k][i] = prc_[k][i];
+    dt_sv_[i] = prc_clk_[i];
+  }
+}
+
+void SatPosClkBatch::GetPreSatPosAtTranst(int i, double *pos) const {
+  for (int k = 0; k < 3; k++) pos[k] = pos_prc_[k][i];
+}
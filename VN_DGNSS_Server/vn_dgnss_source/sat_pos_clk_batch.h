@@ -0,0 +1,85 @@
+#ifndef VN_DGNSS_SERVER_SAT_POS_CLK_BATCH_H
+#define VN_DGNSS_SERVER_SAT_POS_CLK_BATCH_H
+
+#pragma once
+#include <vector>
+
+#include "bkg_data_requestor.h"
+#include "data_struct.h"
+#include "rtklib.h"
+
+// Satellite position/clock of all visible satellites of one constellation,
+// computed together (broadcast Kepler orbit, SSR orbit/clock correction),
+// with the per-satellite inputs and states stored as arrays so every step
+// is one loop over the satellites. No heap allocation.
+class SatPosClkBatch {
+ public:
+  // Max satellites of one constellation in a batch
+  static constexpr int kMaxSat = MAXPRNCMP;
+
+  explicit SatPosClkBatch(int sys);
+
+  void Clear() { n_ = 0; }
+  // Add a satellite with its ephemeris and SSR corrections. Returns the
+  // index in the batch, -1 if the batch is full.
+  int Add(int prn, const satstruct::Ephemeris &eph, const SatOrbitPara &obt_sv,
+          gtime_t t_obt, const SatClockPara &clk_sv, gtime_t t_clk);
+  // Precise position and clock of a signal leaving tp seconds before rcv_t,
+  // without light time solution and earth rotation. Read the results with
+  // GetPreSatPosAtTranst and GetClock.
+  void ComputeAtPropTime(gtime_t rcv_t, double tp);
+
+  int Size() const { return n_; }
+  int GetPrn(int i) const { return prn_[i]; }
+  // Precise satellite position at its transmit time (ECEF)
+  void GetPreSatPosAtTranst(int i, double *pos) const;
+  // Satellite clock bias (m)
+  double GetClock(int i) const { return dt_sv_[i] * CLIGHT; }
+
+ private:
+  // Fixed Newton iterations of the Kepler equation, converged to machine
+  // precision for GNSS eccentricities
+  static constexpr int kKeplerIter = 8;
+
+  const int sys_;
+  const double omge_, mu_, f_;
+  int n_{};
+
+  // Inputs
+  int prn_[kMaxSat]{};
+  bool geo_[kMaxSat]{};
+  gtime_t t_oc_[kMaxSat]{}, t_oe_[kMaxSat]{}, t_obt_[kMaxSat]{},
+      t_clk_[kMaxSat]{};
+  double toes_[kMaxSat]{}, a_f0_[kMaxSat]{}, a_f1_[kMaxSat]{},
+      a_f2_[kMaxSat]{};
+  double M_0_[kMaxSat]{}, e_[kMaxSat]{}, Delta_n_[kMaxSat]{}, sqrtA_[kMaxSat]{},
+      Omega_0_[kMaxSat]{}, i_0_[kMaxSat]{}, omega_[kMaxSat]{},
+      OmegaDot_[kMaxSat]{}, IDOT_[kMaxSat]{};
+  double C_uc_[kMaxSat]{}, C_us_[kMaxSat]{}, C_rc_[kMaxSat]{},
+      C_rs_[kMaxSat]{}, C_ic_[kMaxSat]{}, C_is_[kMaxSat]{};
+  // SSR orbit (RAC, m and m/s) and clock polynomial (m)
+  double dx_[3][kMaxSat]{}, dv_[3][kMaxSat]{}, dt_corr_[3][kMaxSat]{};
+
+  // Receive time minus the reference times (s)
+  double dt_oc_[kMaxSat]{}, dt_oe_[kMaxSat]{}, dt_obt_[kMaxSat]{},
+      dt_clk_[kMaxSat]{};
+  // Propagation time of the signal (s)
+  double tp_[kMaxSat]{};
+  double t_k_[kMaxSat]{}, t_orb_[kMaxSat]{}, clk_[kMaxSat]{};
+  double pos_[3][kMaxSat]{}, vel_[3][kMaxSat]{};
+  // Precise position and clock of the current tp_
+  double prc_[3][kMaxSat]{}, prc_clk_[kMaxSat]{};
+
+  // Outputs
+  double pos_prc_[3][kMaxSat]{};
+  double dt_sv_[kMaxSat]{};
+
+  // Broadcast position/velocity at t_k_ into pos_/vel_, returns sin(E_k)
+  // into sEk
+  void EphPosVel(double *sEk);
+  void SetReceiveTime(gtime_t rcv_t);
+  // Precise position/clock for the current tp_ into prc_/prc_clk_
+  void EvalPrecise();
+};
+
+#endif  // VN_DGNSS_SERVER_SAT_POS_CLK_BATCH_H
@@ -0,0 +1,260 @@
+#include "sat_state_table.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sat_pos_clk_batch.h"
+#include "sat_pos_clk_computer.h"
+#include "stage_metrics.h"
+
+// Find orbit data that match the selected PRN, copied out of the ring
+static bool SelectSatOrbitCorrection(const SsrOrbitRing &ring,
+                                     gtime_t gpst_now, int prn,
+                                     SatOrbitPara &obt_sv, gtime_t &obt_t) {
+  for (int i = 0; i < kSsrDepth; i++) {
+    bool match = false;
+    bool valid = ring.Read(i, [&](const SatOrbitCorrEpoch &sys_data) {
+      const SatOrbitPara &obt_elem = sys_data.data_sv[prn];
+      match = obt_elem.prn != -1 && timediff(gpst_now, sys_data.time) < 200.0;
+      if (match) {
+        obt_sv = obt_elem;
+        obt_t = sys_data.time;
+      }
+    });
+    if (valid && match) return true;
+  }
+  // No data matching
+  return false;
+}
+
+static bool SelectSatClockCorrection(const SsrClockRing &ring,
+                                     gtime_t gpst_now, int prn,
+                                     SatClockPara &clk_sv, gtime_t &clk_t) {
+  for (int i = 0; i < kSsrDepth; i++) {
+    bool match = false;
+    bool valid = ring.Read(i, [&](const SatClockCorrEpoch &sys_data) {
+      const SatClockPara &clk_elem = sys_data.data_sv[prn];
+      match = clk_elem.prn != -1 && timediff(gpst_now, sys_data.time) < 200.0;
+      if (match) {
+        clk_sv = clk_elem;
+        clk_t = sys_data.time;
+      }
+    });
+    if (valid && match) return true;
+  }
+  // No data matching
+  return false;
+}
+
+// Time of the latest epoch of a SSR ring, zero when there is none
+template <typename Ring>
+static gtime_t LatestSsrTime(const Ring &ring) {
+  gtime_t t{};
+  gtime_t latest{};
+  if (ring.Read(0, [&](const auto &sys_data) { t = sys_data.time; })) {
+    latest = t;
+  }
+  return latest;
+}
+
+SatStateTable::SatStateTable(const CorrectionStore &store, gtime_t gpst_now,
+                             const std::vector<double> &date_gps,
+                             int day_of_year)
+    : corr_version_(store.Version()),
+      corr_(store.Acquire()),
+      gpst_now_(gpst_now),
+      date_gps_(date_gps),
+      day_of_year_(day_of_year),
+      vtec_eval_(corr_->vtec_ssr) {
+  for (int sys_i = 0; sys_i < 3; sys_i++) {
+    orbit_time_[sys_i] = LatestSsrTime(store.Orbit(sys_i));
+    clock_time_[sys_i] = LatestSsrTime(store.Clock(sys_i));
+    BuildSystem(store, sys_i);
+  }
+}
+
+void SatStateTable::BuildSystem(const CorrectionStore &store, int sys_i) {
+  int sys_rtklib, max_prn;
+  switch (sys_i) {
+    case 0:
+      sys_rtklib = SYS_GPS;
+      max_prn = MAXPRNGPS;
+      break;
+    case 1:
+      sys_rtklib = SYS_GAL;
+      max_prn = MAXPRNGAL;
+      break;
+    default:
+      sys_rtklib = SYS_CMP;
+      max_prn = MAXPRNCMP;
+      break;
+  }
+  std::vector<SatState> &states = states_[sys_i];
+  states.resize(max_prn + 1);
+  SatPosClkBatch batch(sys_rtklib);
+  // Corrections of one satellite, copied out of the rings
+  SatOrbitPara obt_sv;
+  SatClockPara clk_sv;
+  satstruct::Ephemeris eph;
+  for (int prn = 1; prn < max_prn + 1; prn++) {
+    SatState &st = states[prn];
+    st.prn = prn;
+    if (sys_i == 2 && (prn <= 5 || prn == 18 || prn >= 59)) {
+      st.skip_reason = SatSkipReason::kBdsGeo;
+      continue;
+    }
+    // Pick SSR clock and orbit correction, check the latency
+    gtime_t t_obt{}, t_clk{};
+    if (!(SelectSatOrbitCorrection(store.Orbit(sys_i), gpst_now_, prn,
+                                   obt_sv, t_obt) &&
+          SelectSatClockCorrection(store.Clock(sys_i), gpst_now_, prn,
+                                   clk_sv, t_clk))) {
+      st.skip_reason = SatSkipReason::kNoSsrCorr;
+      continue;
+    }
+    // Ephemeris version of the SSR orbit IOD
+    const SatEphStore &sat_eph = store.Eph(sys_i, prn);
+    if (!sat_eph.FindByIod(obt_sv.IOD, eph)) {
+      st.skip_reason = SatSkipReason::kIodMismatch;
+      st.ssr_iod = obt_sv.IOD;
+      satstruct::Ephemeris healthy;
+      st.IODE = sat_eph.LatestHealthy(healthy) ? (int)healthy.IODE : -1;
+      continue;
+    }
+    double eph_tdiff = timediff(gpst_now_, eph.t_oc);
+    if (std::abs(eph_tdiff) > 7200.0 + 120.0 || eph.svH != 0 ||
+        eph.prn == -1) {
+      st.skip_reason = SatSkipReason::kEphInvalid;
+      st.eph_prn = eph.prn;
+      st.eph_svh = eph.svH;
+      st.eph_tdiff = eph_tdiff;
+      continue;
+    }
+    if (batch.Add(prn, eph, obt_sv, t_obt, clk_sv, t_clk) < 0) break;
+    st.valid = true;
+    st.IODE = (int)eph.IODE;
+    st.eph_tdiff = eph_tdiff;
+    st.t_obt = t_obt;
+    st.t_clk = t_clk;
+    st.dx0 = obt_sv.dx_m[0];
+    st.dv0 = obt_sv.dv_m[0];
+    st.dt0 = clk_sv.dt_corr_s[0];
+  }
+  // Sample the states at the reference propagation time and one step
+  // before/after; the derivatives come from the samples so they hold for the
+  // corrected orbit and clock as a whole
+  double pos[3][SatPosClkBatch::kMaxSat][3], clk[3][SatPosClkBatch::kMaxSat];
+  for (int k = 0; k < 3; k++) {
+    batch.ComputeAtPropTime(gpst_now_, kRefPropTime + (k - 1) * kSampleStep);
+    for (int b = 0; b < batch.Size(); b++) {
+      batch.GetPreSatPosAtTranst(b, pos[k][b]);
+      clk[k][b] = batch.GetClock(b) / CLIGHT;
+    }
+  }
+  // Later transmit time is shorter propagation time: pos[0] is +step
+  for (int b = 0; b < batch.Size(); b++) {
+    SatState &st = states[batch.GetPrn(b)];
+    for (int j = 0; j < 3; j++) {
+      st.pos[j] = pos[1][b][j];
+      st.vel[j] = (pos[0][b][j] - pos[2][b][j]) / (2 * kSampleStep);
+      st.acc[j] = (pos[0][b][j] - 2 * pos[1][b][j] + pos[2][b][j]) /
+                  (kSampleStep * kSampleStep);
+    }
+    st.clk = clk[1][b];
+    st.clk_drift = (clk[0][b] - clk[2][b]) / (2 * kSampleStep);
+  }
+}
+
+void SatStateTable::SolveLightTime(const SatState &st, int sys,
+                                   const std::vector<double> &user_pos,
+                                   double *sat_pos, double &clk_m) {
+  const double omge = OMGE_define(sys);
+  const double ux = user_pos[0], uy = user_pos[1], uz = user_pos[2];
+  double tp = kRefPropTime;
+  double x[3], v[3], dt_clk = st.clk;
+  for (int iter = 0; iter < 10; iter++) {
+    // transmit time offset from the reference state
+    double s = kRefPropTime - tp;
+    for (int k = 0; k < 3; k++) {
+      x[k] = st.pos[k] + st.vel[k] * s + 0.5 * st.acc[k] * s * s;
+      v[k] = st.vel[k] + st.acc[k] * s;
+    }
+    dt_clk = st.clk + st.clk_drift * s;
+    double h = sqrt((ux - x[0]) * (ux - x[0]) + (uy - x[1]) * (uy - x[1]) +
+                    (uz - x[2]) * (uz - x[2]));
+    double dh_dt =
+        -(v[0] * (x[0] - ux) + v[1] * (x[1] - uy) + v[2] * (x[2] - uz)) / h -
+        omge / CLIGHT * (v[0] * uy - v[1] * ux) - CLIGHT;
+    h = h + omge * (x[0] * uy - x[1] * ux) / CLIGHT - (tp + dt_clk) * CLIGHT;
+    double tp_old = tp;
+    tp = tp - h / dh_dt;
+    if (std::abs(tp - tp_old) < 10e-11) break;
+  }
+  // Earth rotation during the propagation time
+  double theta = OMGE * (tp + dt_clk);
+  sat_pos[0] = cos(theta) * x[0] + sin(theta) * x[1];
+  sat_pos[1] = -sin(theta) * x[0] + cos(theta) * x[1];
+  sat_pos[2] = x[2];
+  clk_m = dt_clk * CLIGHT;
+}
+
+std::shared_ptr<const SatStateTable> SatStateCache::Acquire(
+    const CorrectionStore &store) {
+  std::vector<double> date_gps(6, 0);
+  int doy;
+  gtime_t gpst_now;
+  vntimefunc::GetGpsTimeNow(date_gps, doy, gpst_now);
+  return Acquire(store, gpst_now);
+}
+
+std::shared_ptr<const SatStateTable> SatStateCache::Acquire(
+    const CorrectionStore &store, gtime_t gpst_now) {
+  uint64_t version = store.Version();
+  uint64_t start_us = vnmetrics::NowUs();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_ptr<const SatStateTable> cached;
+    if (table_ && table_->GetTime().time == gpst_now.time &&
+        table_->GetCorrVersion() == version) {
+      cached = table_;
+    } else if (table_ && gpst_now.time < table_->GetTime().time &&
+               prev_table_ && prev_table_->GetTime().time == gpst_now.time) {
+      // A late caller of the previous second
+      cached = prev_table_;
+    }
+    if (cached) {
+      vnmetrics::RecordStage(vnmetrics::kSnapshot,
+                             vnmetrics::NowUs() - start_us);
+      return cached;
+    }
+  }
+  // Other callers keep using the cached tables meanwhile
+  std::vector<double> date_gps(6, 0);
+  int doy;
+  vntimefunc::GpsTimeToDate(gpst_now, date_gps, doy);
+  auto table =
+      std::make_shared<const SatStateTable>(store, gpst_now, date_gps, doy);
+  vnmetrics::RecordStage(vnmetrics::kSatStates, vnmetrics::NowUs() - start_us);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (table_ && gpst_now.time < table_->GetTime().time) {
+    // Late, kept for the other late callers of the second
+    if (!prev_table_ || prev_table_->GetTime().time < gpst_now.time) {
+      prev_table_ = table;
+    }
+    return table;
+  }
+  if (table_ && gpst_now.time == table_->GetTime().time &&
+      version <= table_->GetCorrVersion()) {
+    // A concurrent caller built the second first
+    return table_;
+  }
+  if (table_ && table_->GetTime().time < gpst_now.time) prev_table_ = table_;
+  table_ = table;
+  for (int sys_i = 0; sys_i < 3; sys_i++) {
+    const std::vector<SatState> &states = table_->GetSatStates(sys_i);
+    vnmetrics::SetNumOfSat(
+        sys_i, (int)std::count_if(states.begin(), states.end(),
+                                  [](const SatState &st) { return st.valid; }));
+  }
+  return table_;
+}
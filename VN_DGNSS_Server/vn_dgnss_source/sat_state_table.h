@@ -0,0 +1,114 @@
+#ifndef VN_DGNSS_SERVER_SAT_STATE_TABLE_H
+#define VN_DGNSS_SERVER_SAT_STATE_TABLE_H
+
+#pragma once
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "correction_snapshot.h"
+#include "rtklib.h"
+#include "ssr_vtec_correction_model.h"
+
+// Why a satellite of the table cannot be used
+enum class SatSkipReason : uint8_t {
+  kNone,
+  kBdsGeo,
+  // No SSR orbit or clock correction within the latency
+  kNoSsrCorr,
+  // No ephemeris of the SSR orbit IOD
+  kIodMismatch,
+  // Ephemeris unhealthy or too old
+  kEphInvalid
+};
+
+// State of one satellite for the signals of one epoch
+struct SatState {
+  int prn{};
+  // False when the satellite cannot be used, skip_reason tells why
+  bool valid{};
+  SatSkipReason skip_reason{};
+  // kIodMismatch: SSR orbit IOD, IODE of the latest healthy ephemeris (-1
+  // none). kEphInvalid: PRN and health of the ephemeris, and eph_tdiff.
+  int ssr_iod{}, eph_prn{}, eph_svh{};
+  // Precise position (ECEF, m, not rotated) and clock (s) of a signal
+  // leaving SatStateTable::kRefPropTime before the epoch, with their
+  // derivatives w.r.t. the transmit time
+  double pos[3]{}, vel[3]{}, acc[3]{};
+  double clk{}, clk_drift{};
+  // Ephemeris and SSR corrections used
+  int IODE{};
+  double eph_tdiff{};
+  gtime_t t_obt{}, t_clk{};
+  double dx0{}, dv0{}, dt0{};
+};
+
+// Satellite states of all GPS/GAL/BDS satellites for one GPS second,
+// independent of the receiver position. Orbit and clock models (Kepler,
+// SSR corrections) are evaluated once per epoch; each receiver then solves
+// its light time from the cached states by Taylor expansion.
+class SatStateTable {
+ public:
+  // Nominal propagation time the states are evaluated at (s)
+  static constexpr double kRefPropTime = 0.075;
+
+  SatStateTable(const CorrectionStore &store, gtime_t gpst_now,
+                const std::vector<double> &date_gps, int day_of_year);
+
+  gtime_t GetTime() const { return gpst_now_; }
+  const std::vector<double> &GetDate() const { return date_gps_; }
+  int GetDayOfYear() const { return day_of_year_; }
+  const std::shared_ptr<const CorrectionSnapshot> &GetCorrections() const {
+    return corr_;
+  }
+  // CorrectionStore::Version the table was built from
+  uint64_t GetCorrVersion() const { return corr_version_; }
+  // Time of the latest SSR orbit/clock epoch of a system
+  gtime_t GetSsrOrbitTime(int sys_i) const { return orbit_time_[sys_i]; }
+  gtime_t GetSsrClockTime(int sys_i) const { return clock_time_[sys_i]; }
+  // Evaluator of the SSR VTEC of the snapshot
+  const SsrVtecEvaluator &GetVtecEvaluator() const { return vtec_eval_; }
+  // States of a system (0 GPS, 1 GAL, 2 BDS) indexed by PRN
+  const std::vector<SatState> &GetSatStates(int sys_i) const {
+    return states_[sys_i];
+  }
+  // Solve the light time from the satellite to user_pos. Returns the precise
+  // satellite position rotated to the receive time frame and the satellite
+  // clock bias (m).
+  static void SolveLightTime(const SatState &st, int sys,
+                             const std::vector<double> &user_pos,
+                             double *sat_pos, double &clk_m);
+
+ private:
+  // Half span of the samples the derivatives are taken from (s)
+  static constexpr double kSampleStep = 0.01;
+
+  const uint64_t corr_version_;
+  const std::shared_ptr<const CorrectionSnapshot> corr_;
+  const gtime_t gpst_now_;
+  const std::vector<double> date_gps_;
+  const int day_of_year_;
+  const SsrVtecEvaluator vtec_eval_;
+  gtime_t orbit_time_[3]{}, clock_time_[3]{};
+  std::vector<SatState> states_[3];
+
+  void BuildSystem(const CorrectionStore &store, int sys_i);
+};
+
+// Latest SatStateTable, rebuilt when the GPS second or the corrections
+// change, and the table of the previous second for late callers. Shared by
+// all the clients; the tables are built outside the lock.
+class SatStateCache {
+ public:
+  // Table of the current GPS second
+  std::shared_ptr<const SatStateTable> Acquire(const CorrectionStore &store);
+  // Table of the GPS second gpst_now
+  std::shared_ptr<const SatStateTable> Acquire(const CorrectionStore &store,
+                                               gtime_t gpst_now);
+
+ private:
+  std::mutex mutex_;
+  std::shared_ptr<const SatStateTable> table_, prev_table_;
+};
+
+#endif  // VN_DGNSS_SERVER_SAT_STATE_TABLE_H
@@ -1,25 +1,76 @@
 #include "ssr_vtec_correction_model.h"
-#define min(x,y)    ((x)<(y)?(x):(y))
 
-double factorial(int n) {
-  if (n == 0) {
-    return 1;
-  }
-  else {
-    return (n * factorial(n - 1));
+#include <algorithm>
+
+SsrVtecEvaluator::SsrVtecEvaluator(const VTecCorrection& tec)
+    : n_deg(tec.nDeg), n_ord(std::min(tec.nDeg, tec.nOrd)),
+      height_m(tec.height_m) {
+  int dim = n_deg + 1;
+  cos_coeffs.assign(dim * dim, 0.0);
+  sin_coeffs.assign(dim * dim, 0.0);
+  rec_a.assign(dim * dim, 0.0);
+  rec_b.assign(dim * dim, 0.0);
+  diag.assign(dim, 0.0);
+  for (int n = 0; n <= n_deg; n++) {
+    for (int m = 0; m <= std::min(n, n_ord); m++) {
+      cos_coeffs[n * dim + m] = tec.cos_coeffs[n][m];
+      sin_coeffs[n * dim + m] = tec.sin_coeffs[n][m];
+      if (n >= m + 2) {
+        double nm = (double)(n - m) * (n + m);
+        rec_a[n * dim + m] = sqrt((2.0 * n - 1) * (2.0 * n + 1) / nm);
+        rec_b[n * dim + m] =
+            sqrt((2.0 * n + 1) * (n + m - 1) * (n - m - 1) / (nm * (2.0 * n - 3)));
+      }
+    }
   }
+  for (int m = 2; m <= n_ord; m++) diag[m] = sqrt((2.0 * m + 1) / (2.0 * m));
 }
-double associatedLegendreFunction(int n, int m, double t) {
-  double sum = 0.0;
-  int    r   = (int) floor((n - m) / 2);
-  for (int k = 0; k <= r; k++) {
-    sum += (pow(-1.0, (double)k) * factorial(2*n - 2*k)
-            / (factorial(k) * factorial(n-k) * factorial(n-m-2*k))
-            * pow(t, (double)n-m-2*k));
+
+double SsrVtecEvaluator::Vtec(double phi, double lon) const {
+  int dim = n_deg + 1;
+  double t = sin(phi);
+  double u = sqrt(1 - t * t);
+  double cos_l = cos(lon), sin_l = sin(lon);
+  double vtec = 0.0;
+  double pmm = 1.0;
+  // cos/sin(m*lon) of order m and m-1
+  double cm = 1.0, sm = 0.0, cm1 = cos_l, sm1 = -sin_l;
+  for (int m = 0; m <= n_ord; m++) {
+    if (m == 1) {
+      pmm = sqrt(3.0) * u;
+    } else if (m > 1) {
+      pmm *= diag[m] * u;
+    }
+    if (m > 0) {
+      double c = 2 * cos_l * cm - cm1;
+      double s = 2 * cos_l * sm - sm1;
+      cm1 = cm;
+      sm1 = sm;
+      cm = c;
+      sm = s;
+    }
+    // P_mm, P_m+1,m, then P_nm = a * t * P_n-1,m - b * P_n-2,m
+    double p2 = 0.0, p1 = pmm;
+    vtec += (cos_coeffs[m * dim + m] * cm + sin_coeffs[m * dim + m] * sm) * p1;
+    if (m + 1 <= n_deg) {
+      p2 = p1;
+      p1 = sqrt(2.0 * m + 3) * t * pmm;
+      vtec += (cos_coeffs[(m + 1) * dim + m] * cm +
+               sin_coeffs[(m + 1) * dim + m] * sm) * p1;
+    }
+    for (int n = m + 2; n <= n_deg; n++) {
+      double p = rec_a[n * dim + m] * t * p1 - rec_b[n * dim + m] * p2;
+      p2 = p1;
+      p1 = p;
+      vtec += (cos_coeffs[n * dim + m] * cm + sin_coeffs[n * dim + m] * sm) * p;
+    }
+  }
+  if (vtec < 0.0) {
+    return 0.0;
   }
-  double fac = pow(2.0,(double) -n) * pow((1 - t*t), (double)m/2);
-  return sum *= fac;
+  return vtec;
 }
+
 // Constructor
 SsrVtecCorrectionModel::SsrVtecCorrectionModel() {
   _psiPP = _phiPP = _lambdaPP = _lonS = 0.0;
@@ -83,39 +134,12 @@ void SsrVtecCorrectionModel::piercePoint(double layerHeight, double epoch, const
   _lonS = fmod((_lambdaPP + (epoch - 50400) * M_PI / 43200), 2*M_PI);
 }
 
-double SsrVtecCorrectionModel::vtecSingleLayerContribution(const VTecCorrection& tec) const {
-
-  double vtec = 0.0;
-  int N = tec.nDeg;
-  int M = tec.nOrd;
-  double fac;
-
-  for (int n = 0; n <= N; n++) {
-    for (int m = 0; m <= min(n, M); m++) {
-      double pnm = associatedLegendreFunction(n, m, sin(_phiPP));
-      auto a = double(factorial(n - m));
-      auto b = double(factorial(n + m));
-      if (m == 0) {
-        fac = sqrt(2.0 * n + 1);
-      }
-      else {
-        fac = sqrt(2.0 * (2.0 * n + 1) * a / b);
-      }
-      pnm *= fac;
-      double Cnm_mlambda = tec.cos_coeffs[n][m] * cos(m * _lonS);
-      double Snm_mlambda = tec.sin_coeffs[n][m] * sin(m * _lonS);
-      vtec += (Snm_mlambda + Cnm_mlambda) * pnm;
-    }
-  }
-
-  if (vtec < 0.0) {
-    return 0.0;
-  }
-
-  return vtec;
+double SsrVtecCorrectionModel::stec(const VTecCorrection& tec, double gpst_sec, const std::vector<double>& r_ecef,
+                      const std::vector<double>& xyzSat, double sys_F1) {
+  return stec(SsrVtecEvaluator(tec), gpst_sec, r_ecef, xyzSat, sys_F1);
 }
 
-double SsrVtecCorrectionModel::stec(const VTecCorrection& tec, double gpst_sec, const std::vector<double>& r_ecef,
+double SsrVtecCorrectionModel::stec(const SsrVtecEvaluator& vtec_eval, double gpst_sec, const std::vector<double>& r_ecef,
                       const std::vector<double>& xyzSat, double sys_F1) {
 
   // Latitude, longitude, height are defined with respect to a spherical earth model
@@ -132,8 +156,8 @@ double SsrVtecCorrectionModel::stec(const VTecCorrection& tec, double gpst_sec,
   double user_r = sqrt(r_ecef[0]*r_ecef[0]+
                        r_ecef[1]*r_ecef[1]+r_ecef[2]*r_ecef[2]);
   double stec = 0.0;
-  piercePoint(tec.height_m, epoch, geocSta, user_r,azel);
-  double vtec = vtecSingleLayerContribution(tec);
+  piercePoint(vtec_eval.GetHeight(), epoch, geocSta, user_r,azel);
+  double vtec = vtec_eval.Vtec(_phiPP, _lonS);
   stec += vtec / sin(azel[1] + _psiPP);
   return stec*40.3e16/sys_F1/sys_F1;
 }
@@ -1,17 +1,45 @@
+#ifndef VN_DGNSS_SERVER_SSR_VTEC_CORRECTION_MODEL_H
+#define VN_DGNSS_SERVER_SSR_VTEC_CORRECTION_MODEL_H
+
+#pragma once
 
 #include "bkg_data_requestor.h"
 #include "rtklib.h"
+
+// Spherical harmonic expansion of one received VTecCorrection, with the
+// normalization and recurrence coefficients computed once. Evaluates the
+// fully normalized P_nm by the three-term recurrence and cos/sin(m*lon) by
+// the Chebyshev recurrence, i.e. 3 transcendental calls per evaluation.
+class SsrVtecEvaluator {
+public:
+  SsrVtecEvaluator() = default;
+  explicit SsrVtecEvaluator(const VTecCorrection& tec);
+  // VTEC (TECU) at the pierce point latitude phi and sun-fixed longitude lon
+  double Vtec(double phi, double lon) const;
+  double GetHeight() const { return height_m; }
+
+private:
+  int n_deg{-1}, n_ord{-1};
+  double height_m{};
+  // Coefficients and recurrence factors, index n * (n_deg + 1) + m
+  std::vector<double> cos_coeffs, sin_coeffs;
+  std::vector<double> rec_a, rec_b;
+  // sqrt((2m+1)/(2m)) for the sectorial terms
+  std::vector<double> diag;
+};
+
 class SsrVtecCorrectionModel {
 public:
     SsrVtecCorrectionModel();
   ~SsrVtecCorrectionModel();
   double stec(const VTecCorrection& tec, double gpst_sec, const std::vector<double>& r_ecef,
               const std::vector<double>& xyzSat, double sys_F1);
+  double stec(const SsrVtecEvaluator& vtec, double gpst_sec, const std::vector<double>& r_ecef,
+              const std::vector<double>& xyzSat, double sys_F1);
 
 private:
   static void xyz2neu(double* Ell, const double* xyz, double* neu);
   static void satazel(const double *pos,const double *sat, double *azel);
-  double vtecSingleLayerContribution(const VTecCorrection& tec) const;
   void piercePoint(double layerHeight, double epoch, const double* geocSta,
                    double r, const double *azel);
   double _psiPP;
@@ -19,3 +47,5 @@ private:
   double _lambdaPP;
   double _lonS;
 };
+
+#endif  // VN_DGNSS_SERVER_SSR_VTEC_CORRECTION_MODEL_H